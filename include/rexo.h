@@ -118,6 +118,38 @@ typedef char rxp_invalid_uint64_type[sizeof(rx_uint64) == 8 ? 1 : -1];
     TYPE *RX_PARAM_DATA RXP_MAYBE_UNUSED
 #endif
 
+#if defined(_MSC_VER)
+    #define RXP_DEFINE_PROPERTY_PARAMS                                         \
+        _Pragma("warning(push)")                                               \
+        _Pragma("warning(disable : 4100)")                                     \
+        struct rx_context *RX_PARAM_CONTEXT RXP_MAYBE_UNUSED,                  \
+        void *RX_PARAM_DATA RXP_MAYBE_UNUSED,                                  \
+        struct rxp_property *RX_PARAM_PROPERTY RXP_MAYBE_UNUSED                \
+        _Pragma("warning(pop)")
+#else
+    #define RXP_DEFINE_PROPERTY_PARAMS                                         \
+    struct rx_context *RX_PARAM_CONTEXT RXP_MAYBE_UNUSED,                      \
+    void *RX_PARAM_DATA RXP_MAYBE_UNUSED,                                      \
+    struct rxp_property *RX_PARAM_PROPERTY RXP_MAYBE_UNUSED
+#endif
+
+#if defined(_MSC_VER)
+    #define RXP_DEFINE_FUZZ_PARAMS                                             \
+        _Pragma("warning(push)")                                               \
+        _Pragma("warning(disable : 4100)")                                     \
+        struct rx_context *RX_PARAM_CONTEXT RXP_MAYBE_UNUSED,                  \
+        void *RX_PARAM_DATA RXP_MAYBE_UNUSED,                                  \
+        const uint8_t *RX_PARAM_FUZZ_DATA RXP_MAYBE_UNUSED,                    \
+        size_t RX_PARAM_FUZZ_SIZE RXP_MAYBE_UNUSED                             \
+        _Pragma("warning(pop)")
+#else
+    #define RXP_DEFINE_FUZZ_PARAMS                                             \
+    struct rx_context *RX_PARAM_CONTEXT RXP_MAYBE_UNUSED,                      \
+    void *RX_PARAM_DATA RXP_MAYBE_UNUSED,                                      \
+    const uint8_t *RX_PARAM_FUZZ_DATA RXP_MAYBE_UNUSED,                        \
+    size_t RX_PARAM_FUZZ_SIZE RXP_MAYBE_UNUSED
+#endif
+
 /*
    Support compilers that checks printf-style functions.
 */
@@ -135,13 +167,23 @@ typedef char rxp_invalid_uint64_type[sizeof(rx_uint64) == 8 ? 1 : -1];
 #define RX_PARAM_DATA rxp_data
 
 #define RX_DATA RX_PARAM_DATA
+#define RX_SHARED_DATA (RX_PARAM_CONTEXT->shared_data)
+#define RX_SESSION_DATA (RX_PARAM_CONTEXT->session_data)
+#define RX_PARAM (RX_PARAM_CONTEXT->param)
+#define RX_PARAM_PROPERTY rxp_property
+#define RX_PARAM_FUZZ_DATA rxp_fuzz_data
+#define RX_PARAM_FUZZ_SIZE rxp_fuzz_size
+
+#define RX_FUZZ_DATA RX_PARAM_FUZZ_DATA
+#define RX_FUZZ_SIZE RX_PARAM_FUZZ_SIZE
 
 enum rx_status {
     RX_SUCCESS = 0,
     RX_ERROR = -1,
     RX_ERROR_ABORTED = -2,
     RX_ERROR_ALLOCATION = -3,
-    RX_ERROR_MAX_SIZE_EXCEEDED = -4
+    RX_ERROR_MAX_SIZE_EXCEEDED = -4,
+    RX_ERROR_CANCELLED = -5
 };
 
 enum rx_severity { RX_NONFATAL = 0, RX_FATAL = 1 };
@@ -157,6 +199,9 @@ enum rx_log_level {
 };
 
 struct rx_context;
+struct rx_session_fixture;
+struct rxp_benchmark;
+struct rxp_settings;
 
 typedef enum rx_status (*rx_set_up_fn)(RXP_DEFINE_PARAMS(void));
 typedef void (*rx_tear_down_fn)(RXP_DEFINE_PARAMS(void));
@@ -165,6 +210,10 @@ typedef void (*rx_run_fn)(RXP_DEFINE_PARAMS(void));
 struct rx_fixture_config {
     rx_set_up_fn set_up;
     rx_tear_down_fn tear_down;
+    int snapshot;
+    rx_size alignment;
+    int huge_pages;
+    int guard_pages;
 };
 
 struct rx_fixture {
@@ -175,6 +224,10 @@ struct rx_fixture {
 struct rx_test_case_config {
     int skip;
     struct rx_fixture fixture;
+    int parallel_safe;
+    rx_uint64 timeout_ms;
+    struct rx_fixture shared_fixture;
+    struct rx_session_fixture *session_fixture;
 };
 
 struct rx_test_case {
@@ -182,6 +235,8 @@ struct rx_test_case {
     const char *name;
     rx_run_fn run;
     struct rx_test_case_config config;
+    const void *param;
+    int benchmark;
 };
 
 struct rx_failure {
@@ -192,6 +247,17 @@ struct rx_failure {
     const char *diagnostic_msg;
 };
 
+/* Durations per iteration of a benchmark, in nanoseconds. */
+struct rx_benchmark_stats {
+    rx_size sample_count;
+    rx_uint64 iteration_count;
+    double min;
+    double median;
+    double mean;
+    double stddev;
+    double p99;
+};
+
 struct rx_summary {
     const struct rx_test_case *test_case;
     int skipped;
@@ -200,6 +266,8 @@ struct rx_summary {
     rx_size failure_count;
     struct rx_failure *failures;
     rx_uint64 elapsed;
+    int cached;
+    struct rx_benchmark_stats benchmark;
 };
 
 struct rx_summary_group {
@@ -302,6 +370,13 @@ rx_main(rx_size test_case_count,
     #define RXP_HAS_VARIADIC_MACROS 1
 #endif
 
+#if (RXP_LANG == RXP_LANG_C && RXP_LANG_VERSION >= 199901L)                    \
+    || RXP_LANG == RXP_LANG_CPP || (defined(_MSC_VER) && _MSC_VER >= 1800)
+    #define RXP_HAS_LOOP_DECLARATIONS 1
+#else
+    #define RXP_HAS_LOOP_DECLARATIONS 0
+#endif
+
 #define RXP_FALSE ((int)0)
 #define RXP_TRUE ((int)1)
 
@@ -378,6 +453,41 @@ rx_main(rx_size test_case_count,
     RXP_FIXTURE_1(ID, 0, 2, (_0, _1))                                          \
     RXP_REQUIRE_SEMICOLON
 
+#if RXP_HAS_VARIADIC_MACROS
+    #define RX_SESSION_FIXTURE(...)                                            \
+        RXP_EXPAND(                                                            \
+            RXP_CONCAT(                                                        \
+                RXP_SESSION_FIXTURE_DISPATCH_,                                 \
+                RXP_HAS_AT_LEAST_3_ARGS(__VA_ARGS__)                           \
+            )(__VA_ARGS__))                                                    \
+        RXP_REQUIRE_SEMICOLON
+
+    #define RXP_SESSION_FIXTURE_DISPATCH_0(ID, TYPE)                           \
+        RXP_SESSION_FIXTURE_0(ID, sizeof(TYPE))
+
+    #define RXP_SESSION_FIXTURE_DISPATCH_1(ID, TYPE, ...)                      \
+        RXP_SESSION_FIXTURE_1(ID,                                              \
+                              sizeof(TYPE),                                    \
+                              RXP_COUNT_ARGS(__VA_ARGS__),                     \
+                              (__VA_ARGS__))
+#else
+    #define RX_SESSION_FIXTURE(ID, TYPE)                                       \
+        RXP_SESSION_FIXTURE_0(ID, sizeof(TYPE))                                \
+        RXP_REQUIRE_SEMICOLON
+#endif
+
+#define RX_SESSION_FIXTURE_DECLARE(ID)                                         \
+    RXP_SESSION_FIXTURE_DECLARE(ID);                                           \
+    RXP_REQUIRE_SEMICOLON
+
+#define RX_SESSION_FIXTURE_1(ID, TYPE, _0)                                     \
+    RXP_SESSION_FIXTURE_1(ID, sizeof(TYPE), 1, (_0))                           \
+    RXP_REQUIRE_SEMICOLON
+
+#define RX_SESSION_FIXTURE_2(ID, TYPE, _0, _1)                                 \
+    RXP_SESSION_FIXTURE_1(ID, sizeof(TYPE), 2, (_0, _1))                       \
+    RXP_REQUIRE_SEMICOLON
+
 #if RXP_HAS_VARIADIC_MACROS
     #define RX_TEST_SUITE(...)                                                 \
         RXP_EXPAND(                                                            \
@@ -435,6 +545,105 @@ rx_main(rx_size test_case_count,
 #define RX_TEST_CASE_2(SUIE_ID, ID, _0, _1)                                    \
     RXP_TEST_CASE_1(SUIE_ID, ID, 2, (_0, _1))
 
+#if RXP_HAS_VARIADIC_MACROS
+    #define RX_TEST_CASE_PARAMS(...)                                           \
+        RXP_EXPAND(                                                            \
+            RXP_CONCAT(                                                        \
+                RXP_TEST_CASE_PARAMS_DISPATCH_,                                \
+                RXP_HAS_AT_LEAST_5_ARGS(__VA_ARGS__)                           \
+            )(__VA_ARGS__))
+
+    #define RXP_TEST_CASE_PARAMS_DISPATCH_0(SUITE_ID, ID, TABLE, COUNT)        \
+        RXP_TEST_CASE_PARAMS_0(SUITE_ID, ID, TABLE, COUNT)
+
+    #define RXP_TEST_CASE_PARAMS_DISPATCH_1(SUITE_ID, ID, TABLE, COUNT, ...)   \
+        RXP_TEST_CASE_PARAMS_1(SUITE_ID,                                       \
+                               ID,                                             \
+                               TABLE,                                          \
+                               COUNT,                                          \
+                               RXP_COUNT_ARGS(__VA_ARGS__),                    \
+                               (__VA_ARGS__))
+#else
+    #define RX_TEST_CASE_PARAMS(SUITE_ID, ID, TABLE, COUNT)                    \
+        RXP_TEST_CASE_PARAMS_0(SUITE_ID, ID, TABLE, COUNT)
+#endif
+
+#define RX_TEST_CASE_PARAMS_1(SUITE_ID, ID, TABLE, COUNT, _0)                  \
+    RXP_TEST_CASE_PARAMS_1(SUITE_ID, ID, TABLE, COUNT, 1, (_0))
+
+#define RX_TEST_CASE_PARAMS_2(SUITE_ID, ID, TABLE, COUNT, _0, _1)              \
+    RXP_TEST_CASE_PARAMS_1(SUITE_ID, ID, TABLE, COUNT, 2, (_0, _1))
+
+#define RX_FUZZ_TEST(SUITE_ID, ID)                                             \
+    RXP_FUZZ_TEST(SUITE_ID, ID)
+
+#define RX_BENCHMARK(SUITE_ID, ID)                                             \
+    RXP_BENCHMARK(SUITE_ID, ID)
+
+/*
+   The body is run in batches of iterations, with the remaining count of the
+   current batch being decremented straight from the loop condition. The count
+   is kept in a variable local to the loop where the language allows it, for
+   the compiler to keep it in a register rather than reloading it through the
+   context after each iteration.
+*/
+#if RXP_HAS_LOOP_DECLARATIONS
+    #define RX_BENCH_LOOP                                                      \
+        for (rx_uint64 rxp_bench_count                                         \
+             = rxp_benchmark_start(RX_PARAM_CONTEXT);                          \
+             (rxp_bench_count                                                  \
+              = rxp_benchmark_advance(RX_PARAM_CONTEXT, rxp_bench_count))      \
+             > 0;)                                                             \
+            while (rxp_bench_count-- > 0)
+#else
+    #define RX_BENCH_LOOP                                                      \
+        for (RX_PARAM_CONTEXT->benchmark->remaining                            \
+             = rxp_benchmark_start(RX_PARAM_CONTEXT);                          \
+             (RX_PARAM_CONTEXT->benchmark->remaining = rxp_benchmark_advance(  \
+                  RX_PARAM_CONTEXT, RX_PARAM_CONTEXT->benchmark->remaining))   \
+             > 0;)                                                             \
+            while (RX_PARAM_CONTEXT->benchmark->remaining-- > 0)
+#endif
+
+#define RX_PROPERTY(ID)                                                        \
+    static void                                                                \
+    ID(RXP_DEFINE_PROPERTY_PARAMS)
+
+#define RX_PROPERTY_CHECK(ID)                                                  \
+    rxp_property_check(RX_PARAM_CONTEXT,                                       \
+                       RX_PARAM_DATA,                                          \
+                       ID,                                                     \
+                       #ID,                                                    \
+                       __FILE__,                                               \
+                       __LINE__,                                               \
+                       RX_NONFATAL)
+
+#define RX_PROPERTY_REQUIRE(ID)                                                \
+    rxp_property_check(RX_PARAM_CONTEXT,                                       \
+                       RX_PARAM_DATA,                                          \
+                       ID,                                                     \
+                       #ID,                                                    \
+                       __FILE__,                                               \
+                       __LINE__,                                               \
+                       RX_FATAL)
+
+#define RX_GEN_INT(MIN, MAX)                                                   \
+    rxp_property_generate_int(RX_PARAM_PROPERTY, (MIN), (MAX))
+
+#define RX_GEN_UINT(MIN, MAX)                                                  \
+    rxp_property_generate_uint(RX_PARAM_PROPERTY, (MIN), (MAX))
+
+#define RX_GEN_REAL(MIN, MAX)                                                  \
+    rxp_property_generate_real(RX_PARAM_PROPERTY, (MIN), (MAX))
+
+#define RX_GEN_BYTES(BUF, MIN_SIZE, MAX_SIZE)                                  \
+    rxp_property_generate_bytes(                                               \
+        RX_PARAM_PROPERTY, (BUF), (MIN_SIZE), (MAX_SIZE))
+
+#define RX_GEN_STR(BUF, MIN_LENGTH, MAX_LENGTH)                                \
+    rxp_property_generate_str(                                                 \
+        RX_PARAM_PROPERTY, (BUF), (MIN_LENGTH), (MAX_LENGTH))
+
 /* Implementation: Helpers                                         O-(''Q)
    -------------------------------------------------------------------------- */
 
@@ -457,6 +666,7 @@ rx_main(rx_size test_case_count,
 #endif
 
 #include <ctype.h>
+#include <limits.h>
 #include <setjmp.h>
 #include <stdarg.h>
 #include <stddef.h>
@@ -494,6 +704,68 @@ rx_main(rx_size test_case_count,
     #define RXP_FILENO fileno
 #endif
 
+#if defined(RXP_PLATFORM_UNIX)                                                 \
+    && defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 1
+    #include <errno.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <sys/types.h>
+    #include <sys/wait.h>
+    #define RXP_HAS_FORK 1
+#else
+    #define RXP_HAS_FORK 0
+#endif
+
+#if defined(RXP_PLATFORM_UNIX)                                                 \
+    && defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 1
+    #include <dirent.h>
+    #include <sys/stat.h>
+    #define RXP_HAS_DIRENT 1
+#else
+    #define RXP_HAS_DIRENT 0
+#endif
+
+#if defined(RXP_PLATFORM_UNIX)                                                 \
+    && defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 199309L
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #define RXP_HAS_MMAP 1
+#else
+    #define RXP_HAS_MMAP 0
+#endif
+
+#if defined(RXP_PLATFORM_UNIX)                                                 \
+    && defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 2
+    #include <regex.h>
+    #define RXP_HAS_REGEX 1
+#else
+    #define RXP_HAS_REGEX 0
+#endif
+
+#if defined(RXP_PLATFORM_UNIX)                                                 \
+    && defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 199506L
+    #include <pthread.h>
+    #define RXP_HAS_THREADS 1
+#else
+    #define RXP_HAS_THREADS 0
+#endif
+
+/*
+   Prevent the output of concurrent threads from being interleaved within
+   a single log or summary.
+*/
+#if defined(_MSC_VER)
+    #define RXP_LOCK_FILE(F) _lock_file(F)
+    #define RXP_UNLOCK_FILE(F) _unlock_file(F)
+#elif defined(RXP_PLATFORM_UNIX)                                               \
+    && defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 199506L
+    #define RXP_LOCK_FILE(F) flockfile(F)
+    #define RXP_UNLOCK_FILE(F) funlockfile(F)
+#else
+    #define RXP_LOCK_FILE(F)
+    #define RXP_UNLOCK_FILE(F)
+#endif
+
 typedef char rxp_invalid_size_type[sizeof(rx_size) == sizeof(size_t) ? 1 : -1];
 
 #define RXP_UNUSED(X) (void)(X)
@@ -565,6 +837,11 @@ typedef char rxp_invalid_size_type[sizeof(rx_size) == sizeof(size_t) ? 1 : -1];
             __VA_ARGS__,                                                       \
             1, 1, 1, 1, 1, 1, 0, 0,))
 
+    #define RXP_HAS_AT_LEAST_5_ARGS(...)                                       \
+        RXP_EXPAND(RXP_ARG(                                                    \
+            __VA_ARGS__,                                                       \
+            1, 1, 1, 1, 0, 0, 0, 0,))
+
     #define RXP_COUNT_ARGS(...)                                                \
         RXP_EXPAND(RXP_ARG(                                                    \
             __VA_ARGS__,                                                       \
@@ -577,6 +854,11 @@ typedef char rxp_invalid_size_type[sizeof(rx_size) == sizeof(size_t) ? 1 : -1];
 #define RXP_FIXTURE_GET_UPDATE_FN_ID(ID)                                       \
     rxp_fixture_update_fn_##ID
 
+#define RXP_SESSION_FIXTURE_PTR_GET_ID(ID)                                     \
+    rxp_session_fixture_ptr_##ID
+#define RXP_SESSION_FIXTURE_GET_UPDATE_FN_ID(ID)                               \
+    rxp_session_fixture_update_fn_##ID
+
 #define RXP_TEST_SUITE_DESC_GET_ID(ID)                                         \
     rxp_test_suite_desc_##ID
 #define RXP_TEST_SUITE_DESC_PTR_GET_ID(ID)                                     \
@@ -587,6 +869,15 @@ typedef char rxp_invalid_size_type[sizeof(rx_size) == sizeof(size_t) ? 1 : -1];
 #define RXP_TEST_CASE_DESC_PTR_GET_ID(SUITE_ID, ID)                            \
     rxp_test_case_desc_ptr_##SUITE_ID##_##ID
 
+#define RXP_FUZZ_TEST_GET_ID(SUITE_ID, ID)                                     \
+    rxp_fuzz_test_##SUITE_ID##_##ID
+#define RXP_TEST_CASE_PARAMS_GET_ID(SUITE_ID, ID)                              \
+    rxp_test_case_params_##SUITE_ID##_##ID
+#define RXP_TEST_CASE_PARAM_NAMES_GET_ID(SUITE_ID, ID)                         \
+    rxp_test_case_param_names_##SUITE_ID##_##ID
+#define RXP_TEST_CASE_PARAMS_CHECK_GET_ID(SUITE_ID, ID)                        \
+    rxp_invalid_test_case_param_count_##SUITE_ID##_##ID
+
 #define RXP_TEST_CASE_CONFIG_DESC_GET_ID(ID)                                   \
     rxp_test_case_config_desc_##ID
 #define RXP_TEST_CASE_CONFIG_BLUEPRINT_GET_UPDATE_FN_ID(ID)                    \
@@ -599,6 +890,15 @@ typedef long double rxp_real;
 struct rx_context {
     jmp_buf env;
     struct rx_summary *summary;
+    /* Location of the last test assessed. */
+    const char *file;
+    int line;
+    void *shared_data;
+    void *session_data;
+    const void *param;
+    struct rxp_benchmark *benchmark;
+    /* Settings of the runner, shared with the other translation units. */
+    const struct rxp_settings *settings;
 };
 
 /* Implementation: Logger                                          O-(''Q)
@@ -883,6 +1183,7 @@ rxp_log(enum rx_log_level level,
 #endif
 
     va_start(args, fmt);
+    RXP_LOCK_FILE(stderr);
     fprintf(stderr,
             "%s:%d: %s%s%s: ",
             file,
@@ -891,6 +1192,7 @@ rxp_log(enum rx_log_level level,
             level_name,
             level_style_end);
     vfprintf(stderr, fmt, args);
+    RXP_UNLOCK_FILE(stderr);
     va_end(args);
 }
 
@@ -913,10 +1215,13 @@ rxp_log(enum rx_log_level level,
         #define RXP_USE_CLOCK_GETTIME
         #if defined(CLOCK_MONOTONIC_RAW)
             #define RXP_CLOCK_ID CLOCK_MONOTONIC_RAW
+            #define RXP_CLOCK_NAME "monotonic-raw"
         #elif defined(CLOCK_MONOTONIC)
             #define RXP_CLOCK_ID CLOCK_MONOTONIC
+            #define RXP_CLOCK_NAME "monotonic"
         #else
             #define RXP_CLOCK_ID CLOCK_REALTIME
+            #define RXP_CLOCK_NAME "realtime"
         #endif
     #else
         #include <sys/time.h>
@@ -925,8 +1230,36 @@ rxp_log(enum rx_log_level level,
     typedef char rxp_unsupported_platform[-1];
 #endif
 
+#if defined(RXP_USE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+    #define RXP_HAS_CLOCK_MONOTONIC 1
+#else
+    #define RXP_HAS_CLOCK_MONOTONIC 0
+#endif
+
+/*
+   The time stamp counter is read with inline assembly, and is only used when
+   it can be calibrated against the monotonic clock.
+*/
+#if RXP_HAS_CLOCK_MONOTONIC && defined(__GNUC__)                               \
+    && (defined(__x86_64__) || defined(__i386__))
+    #include <cpuid.h>
+    #define RXP_HAS_TSC 1
+#else
+    #define RXP_HAS_TSC 0
+#endif
+
+#if !defined(RXP_CLOCK_NAME)
+    #if defined(RXP_PLATFORM_WINDOWS)
+        #define RXP_CLOCK_NAME "performance-counter"
+    #elif defined(RXP_PLATFORM_DARWIN)
+        #define RXP_CLOCK_NAME "mach-absolute-time"
+    #else
+        #define RXP_CLOCK_NAME "gettimeofday"
+    #endif
+#endif
+
 static enum rx_status
-rxp_get_real_time(uint64_t *time)
+rxp_get_default_time(uint64_t *time)
 {
     RX_ASSERT(time != NULL);
 
@@ -1011,6 +1344,248 @@ rxp_get_real_time(uint64_t *time)
 #endif
 }
 
+/*
+   The clock used to measure the time can be swapped for one that is cheaper
+   to read. On x86, the invariant time stamp counter ticks at a constant rate
+   and is read without entering the kernel, which makes it suitable for short
+   measures, but it needs to be converted into nanoseconds using a rate that
+   is calibrated against the monotonic clock.
+*/
+
+#define RXP_CLOCK_CALIBRATION_TIME_MS 20
+#define RXP_CLOCK_SAMPLE_COUNT 1000
+
+enum rxp_clock_kind {
+    RXP_CLOCK_DEFAULT = 0,
+    RXP_CLOCK_MONOTONIC = 1,
+    RXP_CLOCK_TSC = 2
+};
+
+struct rxp_clock {
+    enum rxp_clock_kind kind;
+    int has_rdtscp;
+    uint64_t tsc_base;
+    uint64_t time_base;
+    double ns_per_tick;
+};
+
+static struct rxp_clock rxp_clock_instance
+    = {RXP_CLOCK_DEFAULT, 0, 0, 0, 0.0};
+
+#if RXP_HAS_CLOCK_MONOTONIC
+static enum rx_status
+rxp_get_monotonic_time(uint64_t *time)
+{
+    struct timespec t;
+
+    RX_ASSERT(time != NULL);
+
+    if (clock_gettime(CLOCK_MONOTONIC, &t) != 0) {
+        RXP_LOG_DEBUG("failed to retrieve the current time\n");
+        return RX_ERROR;
+    }
+
+    *time = (uint64_t)t.tv_sec * RXP_TICKS_PER_SECOND + (uint64_t)t.tv_nsec;
+    return RX_SUCCESS;
+}
+#endif /* RXP_HAS_CLOCK_MONOTONIC */
+
+#if RXP_HAS_TSC
+static uint64_t
+rxp_tsc_read(int has_rdtscp)
+{
+    rx_uint32 low;
+    rx_uint32 high;
+
+    /* Wait for the previous instructions to complete before reading the
+       counter, and for the counter to be read before running the next ones. */
+    if (has_rdtscp) {
+        __asm__ __volatile__("rdtscp\n\tlfence"
+                             : "=a"(low), "=d"(high)
+                             :
+                             : "ecx", "memory");
+    } else {
+        __asm__ __volatile__("lfence\n\trdtsc\n\tlfence"
+                             : "=a"(low), "=d"(high)
+                             :
+                             : "memory");
+    }
+
+    return ((uint64_t)high << 32) | low;
+}
+
+static enum rx_status
+rxp_tsc_calibrate(struct rxp_clock *clock)
+{
+    unsigned int eax;
+    unsigned int ebx;
+    unsigned int ecx;
+    unsigned int edx;
+    uint64_t tsc_begin;
+    uint64_t tsc_end;
+    uint64_t time_begin;
+    uint64_t time_end;
+
+    RX_ASSERT(clock != NULL);
+
+    /* The counter needs to tick at a constant rate, regardless of the
+       frequency and power states of the processor. */
+    if (!__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx)
+        || !(edx & (1u << 8))) {
+        RXP_LOG_WARNING("the time stamp counter is not invariant\n");
+        return RX_ERROR;
+    }
+
+    clock->has_rdtscp = __get_cpuid(0x80000001u, &eax, &ebx, &ecx, &edx)
+                        && (edx & (1u << 27));
+
+    if (rxp_get_monotonic_time(&time_begin) != RX_SUCCESS) {
+        return RX_ERROR;
+    }
+
+    tsc_begin = rxp_tsc_read(clock->has_rdtscp);
+
+    do {
+        if (rxp_get_monotonic_time(&time_end) != RX_SUCCESS) {
+            return RX_ERROR;
+        }
+    } while (time_end - time_begin
+             < RXP_CLOCK_CALIBRATION_TIME_MS * (RXP_TICKS_PER_SECOND / 1000));
+
+    tsc_end = rxp_tsc_read(clock->has_rdtscp);
+    if (tsc_end <= tsc_begin) {
+        RXP_LOG_WARNING("the time stamp counter is not monotonic\n");
+        return RX_ERROR;
+    }
+
+    clock->tsc_base = tsc_end;
+    clock->time_base = time_end;
+    clock->ns_per_tick
+        = (double)(time_end - time_begin) / (double)(tsc_end - tsc_begin);
+    return RX_SUCCESS;
+}
+#endif /* RXP_HAS_TSC */
+
+static enum rx_status
+rxp_clock_get_time(const struct rxp_clock *clock, uint64_t *time)
+{
+    RX_ASSERT(clock != NULL);
+    RX_ASSERT(time != NULL);
+
+    switch (clock->kind) {
+#if RXP_HAS_TSC
+        case RXP_CLOCK_TSC:
+            *time = clock->time_base
+                    + (uint64_t)((double)(rxp_tsc_read(clock->has_rdtscp)
+                                          - clock->tsc_base)
+                                 * clock->ns_per_tick);
+            return RX_SUCCESS;
+#endif
+#if RXP_HAS_CLOCK_MONOTONIC
+        case RXP_CLOCK_MONOTONIC:
+            return rxp_get_monotonic_time(time);
+#endif
+        case RXP_CLOCK_DEFAULT:
+        default:
+            return rxp_get_default_time(time);
+    }
+}
+
+static enum rx_status
+rxp_get_real_time(uint64_t *time)
+{
+    return rxp_clock_get_time(&rxp_clock_instance, time);
+}
+
+static const char *
+rxp_clock_get_name(enum rxp_clock_kind kind)
+{
+    switch (kind) {
+        case RXP_CLOCK_MONOTONIC:
+            return "monotonic";
+        case RXP_CLOCK_TSC:
+            return "tsc";
+        case RXP_CLOCK_DEFAULT:
+        default:
+            return RXP_CLOCK_NAME;
+    }
+}
+
+static enum rx_status
+rxp_clock_select(struct rxp_clock *clock, enum rxp_clock_kind kind)
+{
+    RX_ASSERT(clock != NULL);
+
+    clock->kind = RXP_CLOCK_DEFAULT;
+
+    switch (kind) {
+        case RXP_CLOCK_MONOTONIC:
+#if RXP_HAS_CLOCK_MONOTONIC
+            clock->kind = kind;
+            return RX_SUCCESS;
+#else
+            RXP_LOG_WARNING("the monotonic clock is not supported on this "
+                            "platform\n");
+            return RX_ERROR;
+#endif
+        case RXP_CLOCK_TSC:
+#if RXP_HAS_TSC
+            if (rxp_tsc_calibrate(clock) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            clock->kind = kind;
+            return RX_SUCCESS;
+#else
+            RXP_LOG_WARNING("the time stamp counter is not supported on this "
+                            "platform\n");
+            return RX_ERROR;
+#endif
+        case RXP_CLOCK_DEFAULT:
+        default:
+            return RX_SUCCESS;
+    }
+}
+
+static enum rx_status
+rxp_clock_measure(double *resolution, double *overhead)
+{
+    uint64_t begin;
+    uint64_t end;
+    uint64_t previous;
+    uint64_t now;
+    uint64_t min_step;
+    size_t i;
+
+    RX_ASSERT(resolution != NULL);
+    RX_ASSERT(overhead != NULL);
+
+    /* The overhead is the average cost of a read, while the resolution is
+       the smallest step observed between two consecutive different reads. */
+    if (rxp_get_real_time(&begin) != RX_SUCCESS) {
+        return RX_ERROR;
+    }
+
+    previous = begin;
+    min_step = 0;
+    for (i = 0; i < RXP_CLOCK_SAMPLE_COUNT; ++i) {
+        if (rxp_get_real_time(&now) != RX_SUCCESS) {
+            return RX_ERROR;
+        }
+
+        if (now > previous && (min_step == 0 || now - previous < min_step)) {
+            min_step = now - previous;
+        }
+
+        previous = now;
+    }
+
+    end = previous;
+    *overhead = (double)(end - begin) / RXP_CLOCK_SAMPLE_COUNT;
+    *resolution = (double)min_step;
+    return RX_SUCCESS;
+}
+
 /* Implementation: Test Failure Array                              O-(''Q)
    -------------------------------------------------------------------------- */
 
@@ -1143,6 +1718,14 @@ rxp_test_failure_array_destroy(struct rx_failure *array)
     RX_FREE(RXP_DYN_ARRAY_GET_BLOCK(array));
 }
 
+static void
+rxp_test_failure_array_clear(struct rx_failure *array)
+{
+    RX_ASSERT(array != NULL);
+
+    RXP_DYN_ARRAY_GET_HEADER(RXP_DYN_ARRAY_GET_BLOCK(array))->size = 0;
+}
+
 static void
 rxp_test_failure_array_get_size(size_t *size, const struct rx_failure *array)
 {
@@ -1279,6 +1862,62 @@ rxp_test_failure_array_extend_back(struct rx_failure **slice,
     #define RXP_TEST_SUITE_SECTION_END (&__stop_rxsuite)
 #endif
 
+#if !RXP_TEST_DISCOVERY
+    #define RXP_SESSION_FIXTURE_REGISTER(NAME) RXP_REQUIRE_SEMICOLON
+#elif defined(_MSC_VER)
+    __pragma(section("rxsession$a", read))
+    __pragma(section("rxsession$b", read))
+    __pragma(section("rxsession$c", read))
+
+    __declspec(allocate("rxsession$a"))
+    extern struct rx_session_fixture * const rxp_session_fixture_section_begin
+        = NULL;
+
+    __declspec(allocate("rxsession$c"))
+    extern struct rx_session_fixture * const rxp_session_fixture_section_end
+        = NULL;
+
+    #define RXP_SESSION_FIXTURE_REGISTER(NAME)                                 \
+        __declspec(allocate("rxsession$b"))                                    \
+        extern struct rx_session_fixture * const                               \
+        RXP_SESSION_FIXTURE_PTR_GET_ID(NAME)                                   \
+            = NAME
+
+    #define RXP_SESSION_FIXTURE_SECTION_BEGIN                                  \
+        (&rxp_session_fixture_section_begin + 1)
+    #define RXP_SESSION_FIXTURE_SECTION_END (&rxp_session_fixture_section_end)
+#elif defined(__GNUC__) || defined(__MINGW64__)
+    #if defined(RXP_PLATFORM_DARWIN)
+        extern struct rx_session_fixture * const __start_rxsession             \
+            __asm("section$start$__DATA$rxsession");
+        extern struct rx_session_fixture * const __stop_rxsession              \
+            __asm("section$end$__DATA$rxsession");
+
+        #define RXP_SESSION_FIXTURE_SECTION                                    \
+            RXP_SECTION_SUPPRESS_ADDRESS_SANITIZER                             \
+            __attribute__((used,section("__DATA,rxsession")))
+    #else
+        extern struct rx_session_fixture * const __start_rxsession;
+        extern struct rx_session_fixture * const __stop_rxsession;
+
+        #define RXP_SESSION_FIXTURE_SECTION                                    \
+            RXP_SECTION_SUPPRESS_ADDRESS_SANITIZER                             \
+            __attribute__((used,section("rxsession")))
+    #endif
+
+    RXP_SESSION_FIXTURE_SECTION
+    static struct rx_session_fixture * const rxp_dummy_session_fixture = NULL;
+
+    #define RXP_SESSION_FIXTURE_REGISTER(NAME)                                 \
+        RXP_SESSION_FIXTURE_SECTION                                            \
+        struct rx_session_fixture * const                                      \
+        RXP_SESSION_FIXTURE_PTR_GET_ID(NAME)                                   \
+            = NAME
+
+    #define RXP_SESSION_FIXTURE_SECTION_BEGIN (&__start_rxsession)
+    #define RXP_SESSION_FIXTURE_SECTION_END (&__stop_rxsession)
+#endif
+
 #if !RXP_TEST_DISCOVERY
     #define RXP_TEST_CASE_REGISTER(SUITE_NAME, NAME) RXP_REQUIRE_SEMICOLON
 #elif defined(_MSC_VER)
@@ -1365,25 +2004,117 @@ struct rxp_fixture_desc {
                                                                                \
     RXP_FIXTURE_(ID, SIZE, &RXP_FIXTURE_GET_UPDATE_FN_ID(ID))
 
-/* Implementation: Test Case Config                                O-(''Q)
-   -------------------------------------------------------------------------- */
+RXP_MAYBE_UNUSED static void
+rxp_fixture_initialize(struct rx_fixture *fixture,
+                       const struct rxp_fixture_desc *desc)
+{
+    RX_ASSERT(fixture != NULL);
 
-struct rxp_test_case_config_blueprint {
-    int skip;
-    const struct rxp_fixture_desc *fixture;
-};
+    memset(fixture, 0, sizeof *fixture);
 
-typedef void (*rxp_test_case_config_blueprint_update_fn)(
-    struct rxp_test_case_config_blueprint *);
+    if (desc != NULL) {
+        fixture->size = desc->size;
 
-struct rxp_test_case_config_desc {
-    const rxp_test_case_config_blueprint_update_fn update;
-};
+        if (desc->update != NULL) {
+            desc->update(&fixture->config);
+        }
+    }
+}
 
-#define RXP_TEST_CASE_CONFIG(ID, ARG_COUNT, ARGS)                              \
-    RXP_STRUCT_DEFINE_UPDATE_FN(                                               \
-        RXP_TEST_CASE_CONFIG_BLUEPRINT_GET_UPDATE_FN_ID(ID),                   \
-        struct rxp_test_case_config_blueprint,                                 \
+static int
+rxp_fixture_is_set(const struct rx_fixture *fixture)
+{
+    RX_ASSERT(fixture != NULL);
+
+    return fixture->size > 0 || fixture->config.set_up != NULL
+           || fixture->config.tear_down != NULL;
+}
+
+enum rxp_data_block_kind {
+    RXP_DATA_BLOCK_NONE = 0,
+    RXP_DATA_BLOCK_POOLED = 1,
+    RXP_DATA_BLOCK_ALIGNED = 2,
+    RXP_DATA_BLOCK_MAPPED = 3,
+    RXP_DATA_BLOCK_GUARDED = 4
+};
+
+/* Block of fixture data, along with what's needed to release it. */
+struct rxp_data_block {
+    void *data;
+    void *base;
+    size_t base_size;
+    size_t size;
+    enum rxp_data_block_kind kind;
+};
+
+struct rx_session_fixture {
+    const char *name;
+    rx_size size;
+    const rxp_fixture_config_update_fn update;
+    struct rx_fixture_config config;
+    struct rxp_data_block block;
+    enum rx_status status;
+    int ready;
+};
+
+/*
+   Session fixtures are defined as single-element arrays with external linkage
+   for their name to be usable as a pointer from any translation unit that
+   declares them, including the one defining them.
+*/
+
+#define RXP_SESSION_FIXTURE_DECLARE(ID)                                        \
+    extern struct rx_session_fixture ID[1]
+
+#define RXP_SESSION_FIXTURE_(ID, SIZE, UPDATE_FN)                              \
+    RXP_SESSION_FIXTURE_DECLARE(ID);                                           \
+                                                                               \
+    RXP_SESSION_FIXTURE_REGISTER(ID);                                          \
+                                                                               \
+    struct rx_session_fixture ID[1]                                            \
+        = {{#ID,                                                               \
+            SIZE,                                                              \
+            UPDATE_FN,                                                         \
+            {NULL, NULL, 0, 0, 0, 0},                                          \
+            {NULL, NULL, 0, 0, RXP_DATA_BLOCK_NONE},                           \
+            RX_SUCCESS,                                                        \
+            0}};
+
+#define RXP_SESSION_FIXTURE_0(ID, SIZE)                                        \
+    RXP_SESSION_FIXTURE_(ID, SIZE, NULL)
+
+#define RXP_SESSION_FIXTURE_1(ID, SIZE, ARG_COUNT, ARGS)                       \
+    RXP_STRUCT_DEFINE_UPDATE_FN(                                               \
+        RXP_SESSION_FIXTURE_GET_UPDATE_FN_ID(ID),                              \
+        struct rx_fixture_config,                                              \
+        ARG_COUNT,                                                             \
+        ARGS)                                                                  \
+                                                                               \
+    RXP_SESSION_FIXTURE_(ID, SIZE, &RXP_SESSION_FIXTURE_GET_UPDATE_FN_ID(ID))
+
+/* Implementation: Test Case Config                                O-(''Q)
+   -------------------------------------------------------------------------- */
+
+struct rxp_test_case_config_blueprint {
+    int skip;
+    int parallel_safe;
+    rx_uint64 timeout_ms;
+    const struct rxp_fixture_desc *fixture;
+    const struct rxp_fixture_desc *shared_fixture;
+    struct rx_session_fixture *session_fixture;
+};
+
+typedef void (*rxp_test_case_config_blueprint_update_fn)(
+    struct rxp_test_case_config_blueprint *);
+
+struct rxp_test_case_config_desc {
+    const rxp_test_case_config_blueprint_update_fn update;
+};
+
+#define RXP_TEST_CASE_CONFIG(ID, ARG_COUNT, ARGS)                              \
+    RXP_STRUCT_DEFINE_UPDATE_FN(                                               \
+        RXP_TEST_CASE_CONFIG_BLUEPRINT_GET_UPDATE_FN_ID(ID),                   \
+        struct rxp_test_case_config_blueprint,                                 \
         ARG_COUNT,                                                             \
         ARGS)                                                                  \
                                                                                \
@@ -1416,14 +2147,35 @@ struct rxp_test_suite_desc {
 /* Implementation: Test Case                                       O-(''Q)
    -------------------------------------------------------------------------- */
 
+/*
+   Parameterized test cases are registered once but expand into one test case
+   per row of their table at enumeration time. The names of the rows are
+   formatted on demand into a buffer that is reserved alongside the
+   description, with enough room for any index, to avoid having to manage
+   their lifetime.
+*/
+
+struct rxp_test_case_params {
+    const void *table;
+    rx_size row_size;
+    rx_size row_count;
+    char *names;
+    rx_size name_size;
+};
+
+typedef void (*rxp_fuzz_fn)(RXP_DEFINE_FUZZ_PARAMS);
+
 struct rxp_test_case_desc {
     const char *suite_name;
     const char *name;
     rx_run_fn run;
     const struct rxp_test_case_config_desc *config_desc;
+    const struct rxp_test_case_params *params;
+    rxp_fuzz_fn fuzz;
+    int benchmark;
 };
 
-#define RXP_TEST_CASE_(SUITE_ID, ID, CONFIG_DESC)                              \
+#define RXP_TEST_CASE_(SUITE_ID, ID, CONFIG_DESC, PARAMS, FUZZ, BENCHMARK)     \
     static void                                                                \
     SUITE_ID##_##ID(RXP_DEFINE_PARAMS(void));                                  \
                                                                                \
@@ -1432,7 +2184,10 @@ struct rxp_test_case_desc {
         = {#SUITE_ID,                                                          \
            #ID,                                                                \
            SUITE_ID##_##ID,                                                    \
-           CONFIG_DESC};                                                       \
+           CONFIG_DESC,                                                        \
+           PARAMS,                                                             \
+           FUZZ,                                                               \
+           BENCHMARK};                                                         \
                                                                                \
     RXP_TEST_CASE_REGISTER(SUITE_ID, ID);                                      \
                                                                                \
@@ -1442,13 +2197,92 @@ struct rxp_test_case_desc {
 #define RXP_TEST_CASE_0(SUITE_ID, ID)                                          \
     RXP_TEST_CASE_(SUITE_ID,                                                   \
                    ID,                                                         \
-                   NULL)
+                   NULL,                                                       \
+                   NULL,                                                       \
+                   NULL,                                                       \
+                   0)
 
 #define RXP_TEST_CASE_1(SUITE_ID, ID, ARG_COUNT, ARGS)                         \
     RXP_TEST_CASE_CONFIG(SUITE_ID##_##ID, ARG_COUNT, ARGS)                     \
     RXP_TEST_CASE_(SUITE_ID,                                                   \
                    ID,                                                         \
-                   &RXP_TEST_CASE_CONFIG_DESC_GET_ID(SUITE_ID##_##ID))
+                   &RXP_TEST_CASE_CONFIG_DESC_GET_ID(SUITE_ID##_##ID),         \
+                   NULL,                                                       \
+                   NULL,                                                       \
+                   0)
+
+/* Room for the brackets and for the digits of any 64-bit index. */
+#define RXP_TEST_CASE_PARAM_NAME_SIZE(ID) (sizeof #ID + 22)
+
+#define RXP_TEST_CASE_PARAMS_(SUITE_ID, ID, TABLE, COUNT)                      \
+    /* Fail to compile if the count goes past the end of the table. */         \
+    typedef char RXP_TEST_CASE_PARAMS_CHECK_GET_ID(SUITE_ID, ID)               \
+        [sizeof (TABLE) / sizeof (TABLE)[0] >= (size_t)(COUNT) ? 1 : -1];      \
+                                                                               \
+    static char RXP_TEST_CASE_PARAM_NAMES_GET_ID(SUITE_ID, ID)                 \
+        [(COUNT) > 0 ? (COUNT) : 1][RXP_TEST_CASE_PARAM_NAME_SIZE(ID)];        \
+                                                                               \
+    static const struct rxp_test_case_params                                   \
+    RXP_TEST_CASE_PARAMS_GET_ID(SUITE_ID, ID)                                  \
+        = {(TABLE),                                                            \
+           sizeof (TABLE)[0],                                                  \
+           (COUNT),                                                            \
+           RXP_TEST_CASE_PARAM_NAMES_GET_ID(SUITE_ID, ID)[0],                  \
+           RXP_TEST_CASE_PARAM_NAME_SIZE(ID)};
+
+#define RXP_TEST_CASE_PARAMS_0(SUITE_ID, ID, TABLE, COUNT)                     \
+    RXP_TEST_CASE_PARAMS_(SUITE_ID, ID, TABLE, COUNT)                          \
+    RXP_TEST_CASE_(SUITE_ID,                                                   \
+                   ID,                                                         \
+                   NULL,                                                       \
+                   &RXP_TEST_CASE_PARAMS_GET_ID(SUITE_ID, ID),                 \
+                   NULL,                                                       \
+                   0)
+
+#define RXP_TEST_CASE_PARAMS_1(SUITE_ID, ID, TABLE, COUNT, ARG_COUNT, ARGS)    \
+    RXP_TEST_CASE_PARAMS_(SUITE_ID, ID, TABLE, COUNT)                          \
+    RXP_TEST_CASE_CONFIG(SUITE_ID##_##ID, ARG_COUNT, ARGS)                     \
+    RXP_TEST_CASE_(SUITE_ID,                                                   \
+                   ID,                                                         \
+                   &RXP_TEST_CASE_CONFIG_DESC_GET_ID(SUITE_ID##_##ID),         \
+                   &RXP_TEST_CASE_PARAMS_GET_ID(SUITE_ID, ID),                 \
+                   NULL,                                                       \
+                   0)
+
+/*
+   Fuzz tests are regular test cases replaying their corpus, while their fuzz
+   function is also reachable from the registration section for the fuzzing
+   entry point to dispatch the inputs to.
+*/
+
+#define RXP_FUZZ_TEST(SUITE_ID, ID)                                            \
+    static void                                                                \
+    RXP_FUZZ_TEST_GET_ID(SUITE_ID, ID)(RXP_DEFINE_FUZZ_PARAMS);                \
+                                                                               \
+    RXP_TEST_CASE_(SUITE_ID,                                                   \
+                   ID,                                                         \
+                   NULL,                                                       \
+                   NULL,                                                       \
+                   RXP_FUZZ_TEST_GET_ID(SUITE_ID, ID),                         \
+                   0)                                                          \
+    {                                                                          \
+        rxp_fuzz_test_replay(RX_PARAM_CONTEXT,                                 \
+                             RX_PARAM_DATA,                                    \
+                             RXP_FUZZ_TEST_GET_ID(SUITE_ID, ID),               \
+                             #SUITE_ID,                                        \
+                             #ID);                                             \
+    }                                                                          \
+                                                                               \
+    static void                                                                \
+    RXP_FUZZ_TEST_GET_ID(SUITE_ID, ID)(RXP_DEFINE_FUZZ_PARAMS)
+
+#define RXP_BENCHMARK(SUITE_ID, ID)                                            \
+    RXP_TEST_CASE_(SUITE_ID,                                                   \
+                   ID,                                                         \
+                   NULL,                                                       \
+                   NULL,                                                       \
+                   NULL,                                                       \
+                   1)
 
 /* Implementation: Operators                                       O-(''Q)
    -------------------------------------------------------------------------- */
@@ -1703,252 +2537,7271 @@ rxp_str_copy(char **s, const char *original)
     return RX_SUCCESS;
 }
 
-/* Implementation: Helpers                                         O-(''Q)
+/* Implementation: Filter                                          O-(''Q)
    -------------------------------------------------------------------------- */
 
-RXP_MAYBE_UNUSED static int
-rxp_compare_test_cases(const void *a, const void *b)
+/*
+   Test cases are selected by matching their full name, formatted as
+   `suite_name/name`, against a set of patterns. A test case is selected if it
+   matches any of the positive patterns, or if there are none, and if it
+   matches none of the negative ones, that is the ones prefixed with a `-`.
+
+   Glob patterns support the `*` and `?` wildcards. Regular expressions are
+   only supported on POSIX platforms, and are compiled once upfront.
+*/
+
+enum rxp_filter_pattern_type {
+    RXP_FILTER_PATTERN_GLOB = 0,
+    RXP_FILTER_PATTERN_REGEX = 1
+};
+
+struct rxp_filter_pattern {
+    enum rxp_filter_pattern_type type;
+    int negated;
+    const char *value;
+#if RXP_HAS_REGEX
+    regex_t regex;
+#endif
+};
+
+struct rxp_filter {
+    struct rxp_filter_pattern *patterns;
+    size_t count;
+    size_t positive_count;
+    size_t regex_count;
+};
+
+static void
+rxp_filter_terminate(struct rxp_filter *filter)
 {
-    int out;
-    const struct rx_test_case *aa;
-    const struct rx_test_case *bb;
+    RX_ASSERT(filter != NULL);
 
-    aa = (const struct rx_test_case *)a;
-    bb = (const struct rx_test_case *)b;
+#if RXP_HAS_REGEX
+    {
+        size_t i;
 
-    out = strcmp(aa->suite_name, bb->suite_name);
-    if (out != 0) {
-        return out;
+        for (i = 0; i < filter->count; ++i) {
+            if (filter->patterns[i].type == RXP_FILTER_PATTERN_REGEX) {
+                regfree(&filter->patterns[i].regex);
+            }
+        }
     }
+#endif
 
-    return strcmp(aa->name, bb->name);
+    RX_FREE(filter->patterns);
+    memset(filter, 0, sizeof *filter);
 }
 
-static int
-rxp_compare_summaries_by_test_suite(const void *a, const void *b)
+static enum rx_status
+rxp_filter_add(struct rxp_filter *filter,
+               const char *value,
+               enum rxp_filter_pattern_type type)
 {
-    const struct rx_summary *aa;
-    const struct rx_summary *bb;
+    struct rxp_filter_pattern *patterns;
+    struct rxp_filter_pattern *pattern;
+    int negated;
 
-    aa = (const struct rx_summary *)a;
-    bb = (const struct rx_summary *)b;
-    return strcmp(aa->test_case->suite_name, bb->test_case->suite_name);
-}
+    RX_ASSERT(filter != NULL);
+    RX_ASSERT(value != NULL);
 
-static void
-rxp_real_are_equal_fuzzy(int *result, rxp_real a, rxp_real b, rxp_real tol)
-{
-    rxp_real diff;
-    rxp_real abs_a;
-    rxp_real abs_b;
+    negated = value[0] == '-';
+    if (negated) {
+        ++value;
+    }
 
-    diff = a > b ? a - b : b - a;
-    if (diff <= tol) {
-        *result = 1;
-        return;
+#if !RXP_HAS_REGEX
+    if (type == RXP_FILTER_PATTERN_REGEX) {
+        RXP_LOG_ERROR_1("regular expressions are not supported on this "
+                        "platform: `%s`\n",
+                        value);
+        return RX_ERROR;
     }
+#endif
 
-    abs_a = a < 0 ? -a : a;
-    abs_b = b < 0 ? -b : b;
-    *result = diff <= (abs_a > abs_b ? abs_a : abs_b) * tol;
-}
+    patterns = (struct rxp_filter_pattern *)RX_REALLOC(
+        filter->patterns, sizeof *patterns * (filter->count + 1));
+    if (patterns == NULL) {
+        RXP_LOG_ERROR("failed to allocate the filter\n");
+        return RX_ERROR_ALLOCATION;
+    }
 
-static void
-rxp_str_are_equal(int *result, const char *a, const char *b)
-{
-    while (*a != '\0') {
-        if (*a != *b) {
-            *result = 0;
-            return;
+    filter->patterns = patterns;
+    pattern = &filter->patterns[filter->count];
+    memset(pattern, 0, sizeof *pattern);
+    pattern->type = type;
+    pattern->negated = negated;
+    pattern->value = value;
+
+#if RXP_HAS_REGEX
+    if (type == RXP_FILTER_PATTERN_REGEX) {
+        if (regcomp(&pattern->regex, value, REG_EXTENDED | REG_NOSUB) != 0) {
+            RXP_LOG_ERROR_1("invalid regular expression: `%s`\n", value);
+            return RX_ERROR;
         }
 
-        ++a;
-        ++b;
+        ++filter->regex_count;
     }
+#endif
 
-    *result = *a == *b;
+    ++filter->count;
+    filter->positive_count += (size_t)!negated;
+    return RX_SUCCESS;
 }
 
-static void
-rxp_str_are_equal_no_case(int *result, const char *a, const char *b)
+static int
+rxp_glob_match(const char *pattern, const char *suite_name, const char *name)
 {
-    while (*a != '\0') {
-        if (tolower(*a) != tolower(*b)) {
-            *result = 0;
-            return;
+    const char *star;
+    size_t suite_name_length;
+    size_t length;
+    size_t star_i;
+    size_t i;
+
+    RX_ASSERT(pattern != NULL);
+    RX_ASSERT(suite_name != NULL);
+    RX_ASSERT(name != NULL);
+
+    /* Match against `suite_name/name` without building the string. */
+    suite_name_length = strlen(suite_name);
+    length = suite_name_length + 1 + strlen(name);
+
+    star = NULL;
+    star_i = 0;
+    i = 0;
+    while (i < length) {
+        char c;
+
+        c = i < suite_name_length    ? suite_name[i]
+            : i == suite_name_length ? '/'
+                                     : name[i - suite_name_length - 1];
+
+        if (*pattern == '*') {
+            star = ++pattern;
+            star_i = i;
+        } else if (*pattern != '\0' && (*pattern == '?' || *pattern == c)) {
+            ++pattern;
+            ++i;
+        } else if (star != NULL) {
+            /* Backtrack by letting the last star consume one more char. */
+            pattern = star;
+            i = ++star_i;
+        } else {
+            return RXP_FALSE;
         }
+    }
 
-        ++a;
-        ++b;
+    while (*pattern == '*') {
+        ++pattern;
     }
 
-    *result = tolower(*a) == tolower(*b);
+    return *pattern == '\0';
 }
 
-RXP_MAYBE_UNUSED static enum rx_status
-rxp_run_test_cases(size_t test_case_count,
-                   const struct rx_test_case *test_cases)
+static int
+rxp_filter_pattern_match(const struct rxp_filter_pattern *pattern,
+                         const char *full_name,
+                         const char *suite_name,
+                         const char *name)
 {
-    size_t i;
-    enum rx_status status;
-    struct rx_summary *summaries;
+    RX_ASSERT(pattern != NULL);
 
-    if (test_case_count == 0) {
-        RXP_LOG_INFO("nothing to run\n");
-        return RX_SUCCESS;
+#if RXP_HAS_REGEX
+    if (pattern->type == RXP_FILTER_PATTERN_REGEX) {
+        RX_ASSERT(full_name != NULL);
+        return regexec(&pattern->regex, full_name, 0, NULL, 0) == 0;
     }
+#else
+    RXP_UNUSED(full_name);
+#endif
 
-    RX_ASSERT(test_cases != NULL);
+    return rxp_glob_match(pattern->value, suite_name, name);
+}
 
-    summaries = (struct rx_summary *)RX_MALLOC(sizeof *summaries
-                                               * test_case_count);
-    if (summaries == NULL) {
-        RXP_LOG_DEBUG("failed to allocate the summaries\n");
-        return RX_ERROR_ALLOCATION;
-    }
+static enum rx_status
+rxp_filter_match(int *matched,
+                 const struct rxp_filter *filter,
+                 const char *suite_name,
+                 const char *name)
+{
+    char buffer[256];
+    char *full_name;
+    size_t i;
 
-    status = RX_SUCCESS;
+    RX_ASSERT(matched != NULL);
+    RX_ASSERT(filter != NULL);
+    RX_ASSERT(suite_name != NULL);
+    RX_ASSERT(name != NULL);
 
-    for (i = 0; i < test_case_count;) {
-        const struct rx_test_case *test_case;
-        struct rx_summary *summary;
+    full_name = NULL;
 
-        test_case = &test_cases[i];
-        summary = &summaries[i];
+#if RXP_HAS_REGEX
+    if (filter->regex_count > 0) {
+        size_t suite_name_length;
+        size_t name_length;
+        size_t size;
 
-        RX_ASSERT(test_case->suite_name != NULL);
-        RX_ASSERT(test_case->name != NULL);
+        suite_name_length = strlen(suite_name);
+        name_length = strlen(name);
+        size = suite_name_length + name_length + 2;
 
-        status = rx_summary_initialize(summary, test_case);
-        if (status != RX_SUCCESS) {
-            RXP_LOG_ERROR_2("failed to initialize the summary "
-                            "(suite: \"%s\", case: \"%s\")\n",
-                            test_case->suite_name,
-                            test_case->name);
-            goto summaries_cleanup;
+        /* Only allocate for the names that are unusually long. */
+        if (size <= sizeof buffer) {
+            full_name = buffer;
+        } else {
+            full_name = (char *)RX_MALLOC(sizeof *full_name * size);
+            if (full_name == NULL) {
+                RXP_LOG_ERROR_2("failed to allocate the full name of a test "
+                                "case (suite: \"%s\", case: \"%s\")\n",
+                                suite_name,
+                                name);
+                return RX_ERROR_ALLOCATION;
+            }
         }
 
-        ++i;
+        memcpy(full_name, suite_name, suite_name_length);
+        full_name[suite_name_length] = '/';
+        memcpy(&full_name[suite_name_length + 1], name, name_length + 1);
+    }
+#else
+    RXP_UNUSED(buffer);
+#endif
 
-        status = rx_test_case_run(summary, test_case);
-        if (status != RX_SUCCESS) {
-            RXP_LOG_ERROR_2("failed to run a test case "
-                            "(suite: \"%s\", case: \"%s\")\n",
-                            test_case->suite_name,
-                            test_case->name);
-            goto summaries_cleanup;
-        }
+    *matched = filter->positive_count == 0;
+    for (i = 0; i < filter->count && !*matched; ++i) {
+        *matched = !filter->patterns[i].negated
+                   && rxp_filter_pattern_match(
+                       &filter->patterns[i], full_name, suite_name, name);
+    }
 
-        rx_summary_print(summary);
+    for (i = 0; i < filter->count && *matched; ++i) {
+        *matched = !filter->patterns[i].negated
+                   || !rxp_filter_pattern_match(
+                       &filter->patterns[i], full_name, suite_name, name);
     }
 
-    if (status == RX_SUCCESS) {
-        size_t j;
+    if (full_name != buffer) {
+        RX_FREE(full_name);
+    }
 
-        for (j = 0; j < test_case_count; ++j) {
-            size_t k;
-            struct rx_summary *summary;
+    return RX_SUCCESS;
+}
 
-            summary = &summaries[j];
+/* Implementation: Options                                         O-(''Q)
+   -------------------------------------------------------------------------- */
 
-            for (k = 0; k < summary->failure_count; ++k) {
-                const struct rx_failure *failure;
+enum rxp_list_format {
+    RXP_LIST_FORMAT_NONE = 0,
+    RXP_LIST_FORMAT_PLAIN = 1,
+    RXP_LIST_FORMAT_JSON = 2
+};
 
-                failure = &summary->failures[k];
-                if (failure->severity == RX_FATAL) {
-                    status = RX_ERROR_ABORTED;
-                    goto summaries_cleanup;
-                }
-            }
-        }
-    }
+struct rxp_options {
+    size_t job_count;
+    size_t thread_count;
+    const char *timing_path;
+    size_t shard_index;
+    size_t shard_count;
+    const char *shard_timing_path;
+    size_t max_failure_count;
+    rx_uint64 timeout_ms;
+    size_t isolation_batch_size;
+    struct rxp_filter filter;
+    enum rxp_list_format list_format;
+    size_t repeat_count;
+    int until_fail;
+    int shuffle;
+    int has_seed;
+    rx_uint32 seed;
+    const char *cache_path;
+    const char *cache_key;
+    int no_cache;
+    const char *last_run_path;
+    int failed_first;
+    int last_failed;
+    size_t property_run_count;
+    int has_property_seed;
+    rx_uint32 property_seed;
+    const char *corpus_path;
+    int benchmark;
+    rx_uint64 benchmark_min_time_ms;
+    size_t benchmark_sample_count;
+    enum rxp_clock_kind clock;
+};
 
-summaries_cleanup:
-    while (i-- > 0) {
-        rx_summary_terminate(&summaries[i]);
-    }
+#define RXP_PROPERTY_DEFAULT_RUN_COUNT 100
+#define RXP_BENCHMARK_DEFAULT_MIN_TIME_MS 10
+#define RXP_BENCHMARK_DEFAULT_SAMPLE_COUNT 20
 
-    RX_FREE(summaries);
+/*
+   Settings read from within the test cases, which don't have access to the
+   options. Each translation unit has its own copy of the private globals, so
+   the runner hands its settings over to the test cases through their context
+   rather than them reading the instance of their translation unit.
+*/
+struct rxp_settings {
+    size_t property_run_count;
+    rx_uint32 property_seed;
+    const char *corpus_path;
+    int benchmark;
+    rx_uint64 benchmark_min_time_ms;
+    size_t benchmark_sample_count;
+    const struct rxp_clock *clock;
+};
 
-    return status;
+static struct rxp_settings rxp_settings_instance
+    = {RXP_PROPERTY_DEFAULT_RUN_COUNT,
+       0,
+       NULL,
+       0,
+       RXP_BENCHMARK_DEFAULT_MIN_TIME_MS,
+       RXP_BENCHMARK_DEFAULT_SAMPLE_COUNT,
+       &rxp_clock_instance};
+
+static const struct rxp_settings *
+rxp_context_get_settings(const struct rx_context *context)
+{
+    if (context == NULL || context->settings == NULL) {
+        return &rxp_settings_instance;
+    }
+
+    return context->settings;
 }
 
-RXP_MAYBE_UNUSED static enum rx_status
-rxp_run_registered_test_cases(void)
+static void
+rxp_get_cpu_count(size_t *count)
 {
-    enum rx_status out;
-    rx_size test_case_count;
-    struct rx_test_case *test_cases;
+    RX_ASSERT(count != NULL);
 
-    rx_enumerate_test_cases(&test_case_count, NULL);
-    if (test_case_count == 0) {
-        return rxp_run_test_cases(0, NULL);
+#if defined(RXP_PLATFORM_WINDOWS)
+    {
+        SYSTEM_INFO info;
+
+        GetSystemInfo(&info);
+        *count = (size_t)info.dwNumberOfProcessors;
     }
+#elif defined(_SC_NPROCESSORS_ONLN)
+    {
+        long value;
 
-    test_cases = (struct rx_test_case *)RX_MALLOC(sizeof *test_cases
-                                                  * test_case_count);
-    if (test_cases == NULL) {
+        value = sysconf(_SC_NPROCESSORS_ONLN);
+        *count = value > 0 ? (size_t)value : 1;
+    }
+#else
+    *count = 1;
+#endif
+}
+
+static enum rx_status
+rxp_str_to_size(size_t *value, const char *s)
+{
+    RX_ASSERT(value != NULL);
+    RX_ASSERT(s != NULL);
+
+    if (*s == '\0') {
+        return RX_ERROR;
+    }
+
+    *value = 0;
+    for (; *s != '\0'; ++s) {
+        size_t digit;
+
+        if (*s < '0' || *s > '9') {
+            return RX_ERROR;
+        }
+
+        digit = (size_t)(*s - '0');
+        if (*value > ((size_t)-1 - digit) / 10) {
+            return RX_ERROR_MAX_SIZE_EXCEEDED;
+        }
+
+        *value = *value * 10 + digit;
+    }
+
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_str_to_uint64(rx_uint64 *value, const char *s)
+{
+    RX_ASSERT(value != NULL);
+    RX_ASSERT(s != NULL);
+
+    if (*s == '\0') {
+        return RX_ERROR;
+    }
+
+    *value = 0;
+    for (; *s != '\0'; ++s) {
+        rx_uint64 digit;
+
+        if (*s < '0' || *s > '9') {
+            return RX_ERROR;
+        }
+
+        digit = (rx_uint64)(*s - '0');
+        if (*value > ((rx_uint64)-1 - digit) / 10) {
+            return RX_ERROR_MAX_SIZE_EXCEEDED;
+        }
+
+        *value = *value * 10 + digit;
+    }
+
+    return RX_SUCCESS;
+}
+
+static int
+rxp_arg_match(const char **value, const char *arg, const char *name)
+{
+    size_t length;
+
+    RX_ASSERT(value != NULL);
+    RX_ASSERT(arg != NULL);
+    RX_ASSERT(name != NULL);
+
+    length = strlen(name);
+    if (strncmp(arg, name, length) != 0) {
+        return RXP_FALSE;
+    }
+
+    if (arg[length] == '\0') {
+        *value = NULL;
+        return RXP_TRUE;
+    }
+
+    if (arg[length] == '=') {
+        *value = &arg[length + 1];
+        return RXP_TRUE;
+    }
+
+    return RXP_FALSE;
+}
+
+static enum rx_status
+rxp_arg_get_value(const char **value,
+                  int *i,
+                  int argc,
+                  const char * const *argv)
+{
+    RX_ASSERT(value != NULL);
+    RX_ASSERT(i != NULL);
+    RX_ASSERT(argv != NULL);
+
+    /* Support both the `--name=value` and the `--name value` forms. */
+    if (*value != NULL) {
+        return RX_SUCCESS;
+    }
+
+    if (*i + 1 >= argc) {
+        RXP_LOG_ERROR_1("missing value for the argument `%s`\n", argv[*i]);
+        return RX_ERROR;
+    }
+
+    *value = argv[++*i];
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_options_parse(struct rxp_options *options,
+                  int argc,
+                  const char * const *argv)
+{
+    int i;
+
+    RX_ASSERT(options != NULL);
+
+    memset(options, 0, sizeof *options);
+    options->job_count = 1;
+    options->thread_count = 1;
+    options->shard_count = 1;
+
+    for (i = 1; i < argc; ++i) {
+        const char *arg;
+        const char *value;
+
+        arg = argv[i];
+        RX_ASSERT(arg != NULL);
+
+        if (rxp_arg_match(&value, arg, "--jobs")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_size(&options->job_count, value) != RX_SUCCESS) {
+                RXP_LOG_ERROR_1("invalid number of jobs: `%s`\n", value);
+                return RX_ERROR;
+            }
+
+            if (options->job_count == 0) {
+                rxp_get_cpu_count(&options->job_count);
+            }
+        } else if (rxp_arg_match(&value, arg, "--threads")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_size(&options->thread_count, value)
+                != RX_SUCCESS) {
+                RXP_LOG_ERROR_1("invalid number of threads: `%s`\n", value);
+                return RX_ERROR;
+            }
+
+            if (options->thread_count == 0) {
+                rxp_get_cpu_count(&options->thread_count);
+            }
+        } else if (rxp_arg_match(&value, arg, "--timing-file")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            options->timing_path = value;
+        } else if (rxp_arg_match(&value, arg, "--shard-timing-file")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            options->shard_timing_path = value;
+        } else if (rxp_arg_match(&value, arg, "--fail-fast")) {
+            options->max_failure_count = 1;
+        } else if (rxp_arg_match(&value, arg, "--max-failures")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_size(&options->max_failure_count, value)
+                != RX_SUCCESS) {
+                RXP_LOG_ERROR_1("invalid number of failures: `%s`\n", value);
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--timeout")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_uint64(&options->timeout_ms, value)
+                != RX_SUCCESS) {
+                RXP_LOG_ERROR_1("invalid timeout: `%s`\n", value);
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--filter")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS
+                || rxp_filter_add(
+                       &options->filter, value, RXP_FILTER_PATTERN_GLOB)
+                       != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--filter-regex")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS
+                || rxp_filter_add(
+                       &options->filter, value, RXP_FILTER_PATTERN_REGEX)
+                       != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--list")) {
+            /* The format is optional, hence the `--list=FORMAT` form only. */
+            if (value == NULL || strcmp(value, "plain") == 0) {
+                options->list_format = RXP_LIST_FORMAT_PLAIN;
+            } else if (strcmp(value, "json") == 0) {
+                options->list_format = RXP_LIST_FORMAT_JSON;
+            } else {
+                RXP_LOG_ERROR_1("invalid list format: `%s`\n", value);
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--repeat")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_size(&options->repeat_count, value) != RX_SUCCESS
+                || options->repeat_count == 0) {
+                RXP_LOG_ERROR_1("invalid number of repetitions: `%s`\n",
+                                value);
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--until-fail")) {
+            options->until_fail = RXP_TRUE;
+        } else if (rxp_arg_match(&value, arg, "--shuffle")) {
+            options->shuffle = RXP_TRUE;
+        } else if (rxp_arg_match(&value, arg, "--seed")) {
+            rx_uint64 seed;
+
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_uint64(&seed, value) != RX_SUCCESS
+                || seed > 0xFFFFFFFFu) {
+                RXP_LOG_ERROR_1("invalid seed: `%s`\n", value);
+                return RX_ERROR;
+            }
+
+            /* Setting a seed implies shuffling. */
+            options->shuffle = RXP_TRUE;
+            options->has_seed = RXP_TRUE;
+            options->seed = (rx_uint32)seed;
+        } else if (rxp_arg_match(&value, arg, "--property-runs")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_size(&options->property_run_count, value)
+                    != RX_SUCCESS
+                || options->property_run_count == 0) {
+                RXP_LOG_ERROR_1("invalid number of property runs: `%s`\n",
+                                value);
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--property-seed")) {
+            rx_uint64 seed;
+
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_uint64(&seed, value) != RX_SUCCESS
+                || seed > 0xFFFFFFFFu) {
+                RXP_LOG_ERROR_1("invalid property seed: `%s`\n", value);
+                return RX_ERROR;
+            }
+
+            options->has_property_seed = RXP_TRUE;
+            options->property_seed = (rx_uint32)seed;
+        } else if (rxp_arg_match(&value, arg, "--corpus")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            options->corpus_path = value;
+        } else if (rxp_arg_match(&value, arg, "--clock")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (strcmp(value, "default") == 0) {
+                options->clock = RXP_CLOCK_DEFAULT;
+            } else if (strcmp(value, "monotonic") == 0) {
+                options->clock = RXP_CLOCK_MONOTONIC;
+            } else if (strcmp(value, "tsc") == 0) {
+                options->clock = RXP_CLOCK_TSC;
+            } else {
+                RXP_LOG_ERROR_1("invalid clock: `%s`\n", value);
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--benchmark")) {
+            options->benchmark = RXP_TRUE;
+        } else if (rxp_arg_match(&value, arg, "--benchmark-min-time")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_uint64(&options->benchmark_min_time_ms, value)
+                    != RX_SUCCESS
+                || options->benchmark_min_time_ms == 0) {
+                RXP_LOG_ERROR_1("invalid benchmark minimum time: `%s`\n",
+                                value);
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--benchmark-samples")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_size(&options->benchmark_sample_count, value)
+                    != RX_SUCCESS
+                || options->benchmark_sample_count == 0) {
+                RXP_LOG_ERROR_1("invalid number of benchmark samples: `%s`\n",
+                                value);
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--cache")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            options->cache_path = value;
+        } else if (rxp_arg_match(&value, arg, "--cache-key")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            options->cache_key = value;
+        } else if (rxp_arg_match(&value, arg, "--no-cache")) {
+            options->no_cache = RXP_TRUE;
+        } else if (rxp_arg_match(&value, arg, "--last-run-file")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            options->last_run_path = value;
+        } else if (rxp_arg_match(&value, arg, "--failed-first")) {
+            options->failed_first = RXP_TRUE;
+        } else if (rxp_arg_match(&value, arg, "--last-failed")) {
+            options->last_failed = RXP_TRUE;
+        } else if (rxp_arg_match(&value, arg, "--isolate")) {
+            /* The batch size is optional, hence the `--isolate=N` form only. */
+            if (value == NULL) {
+                options->isolation_batch_size = 1;
+            } else if (rxp_str_to_size(&options->isolation_batch_size, value)
+                           != RX_SUCCESS
+                       || options->isolation_batch_size == 0) {
+                RXP_LOG_ERROR_1("invalid isolation batch size: `%s`\n",
+                                value);
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--shard-index")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_size(&options->shard_index, value) != RX_SUCCESS) {
+                RXP_LOG_ERROR_1("invalid shard index: `%s`\n", value);
+                return RX_ERROR;
+            }
+        } else if (rxp_arg_match(&value, arg, "--shard-count")) {
+            if (rxp_arg_get_value(&value, &i, argc, argv) != RX_SUCCESS) {
+                return RX_ERROR;
+            }
+
+            if (rxp_str_to_size(&options->shard_count, value) != RX_SUCCESS
+                || options->shard_count == 0) {
+                RXP_LOG_ERROR_1("invalid number of shards: `%s`\n", value);
+                return RX_ERROR;
+            }
+        } else {
+            RXP_LOG_WARNING_1("ignoring the unknown argument `%s`\n", arg);
+        }
+    }
+
+#if !RXP_HAS_FORK
+    if (options->isolation_batch_size > 0) {
+        RXP_LOG_WARNING("isolating the test cases is not supported on this "
+                        "platform, running them within the runner\n");
+        options->isolation_batch_size = 0;
+    }
+#else
+    /* Forking from a multithreaded process could leave the children with
+       locks held by the other threads. */
+    if (options->isolation_batch_size > 0 && options->thread_count > 1) {
+        RXP_LOG_WARNING("worker threads cannot be combined with isolated "
+                        "test cases, ignoring the threads\n");
+        options->thread_count = 1;
+    }
+#endif
+
+    /* Without a key, changes to the test cases would go unnoticed. */
+    if (options->cache_path != NULL && options->cache_key == NULL) {
+        RXP_LOG_ERROR("the cache requires a key to be set with "
+                      "`--cache-key`\n");
+        return RX_ERROR;
+    }
+
+    if ((options->failed_first || options->last_failed)
+        && options->last_run_path == NULL) {
+        RXP_LOG_ERROR("selecting the failed test cases requires a last run "
+                      "file to be set with `--last-run-file`\n");
+        return RX_ERROR;
+    }
+
+    if (options->shard_index >= options->shard_count) {
+        RXP_LOG_ERROR_2("the shard index %lu is out of range for %lu shards\n",
+                        (unsigned long)options->shard_index,
+                        (unsigned long)options->shard_count);
+        return RX_ERROR;
+    }
+
+    return RX_SUCCESS;
+}
+
+static size_t
+rxp_options_get_pass_count(const struct rxp_options *options)
+{
+    RX_ASSERT(options != NULL);
+
+    /* Repeating until a failure occurs is unbounded by default. */
+    if (options->repeat_count > 0) {
+        return options->repeat_count;
+    }
+
+    return options->until_fail ? (size_t)-1 : 1;
+}
+
+static void
+rxp_options_terminate(struct rxp_options *options)
+{
+    RX_ASSERT(options != NULL);
+
+    rxp_filter_terminate(&options->filter);
+}
+
+static int
+rxp_failure_budget_consume(size_t *failed_count,
+                           const struct rx_summary *summary,
+                           size_t max_failure_count)
+{
+    RX_ASSERT(failed_count != NULL);
+    RX_ASSERT(summary != NULL);
+
+    if (summary->failure_count == 0) {
+        return RXP_FALSE;
+    }
+
+    ++*failed_count;
+    return max_failure_count > 0 && *failed_count >= max_failure_count;
+}
+
+static void
+rxp_failure_budget_skip_pending(struct rx_summary *summaries,
+                                const char *completed,
+                                size_t begin,
+                                size_t end)
+{
+    size_t i;
+
+    RX_ASSERT(summaries != NULL);
+
+    /* Flag the test cases that a cancelled run didn't complete as skipped
+       for the persisted files to keep their previous state. */
+    for (i = begin; i < end; ++i) {
+        if (completed == NULL || !completed[i]) {
+            summaries[i].skipped = 1;
+        }
+    }
+}
+
+/* Implementation: Records                                         O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   Records associate a 64-bit value to each test case, and are persisted to
+   a file. Each line of the file holds a single record made of the suite name,
+   the test case name, and the value, all separated by tabulations. Test cases
+   with names containing any of these separators are never persisted.
+*/
+
+struct rxp_record {
+    const char *suite_name;
+    const char *name;
+    rx_uint64 value;
+    int matched;
+};
+
+struct rxp_records {
+    char *data;
+    size_t count;
+    struct rxp_record *entries;
+};
+
+static int
+rxp_compare_records(const void *a, const void *b)
+{
+    int out;
+    const struct rxp_record *aa;
+    const struct rxp_record *bb;
+
+    aa = (const struct rxp_record *)a;
+    bb = (const struct rxp_record *)b;
+
+    out = strcmp(aa->suite_name, bb->suite_name);
+    if (out != 0) {
+        return out;
+    }
+
+    return strcmp(aa->name, bb->name);
+}
+
+static enum rx_status
+rxp_file_read(char **data, size_t *size, const char *path)
+{
+    FILE *file;
+    long length;
+
+    RX_ASSERT(data != NULL);
+    RX_ASSERT(size != NULL);
+    RX_ASSERT(path != NULL);
+
+    file = fopen(path, "rb");
+    if (file == NULL) {
+        return RX_ERROR;
+    }
+
+    if (fseek(file, 0, SEEK_END) != 0 || (length = ftell(file)) < 0
+        || fseek(file, 0, SEEK_SET) != 0) {
+        RXP_LOG_ERROR_1("failed to retrieve the size of the file `%s`\n",
+                        path);
+        fclose(file);
+        return RX_ERROR;
+    }
+
+    *size = (size_t)length;
+    *data = (char *)RX_MALLOC(*size + 1);
+    if (*data == NULL) {
+        RXP_LOG_ERROR_1("failed to allocate the content of the file `%s`\n",
+                        path);
+        fclose(file);
+        return RX_ERROR_ALLOCATION;
+    }
+
+    if (fread(*data, 1, *size, file) != *size) {
+        RXP_LOG_ERROR_1("failed to read the file `%s`\n", path);
+        RX_FREE(*data);
+        fclose(file);
+        return RX_ERROR;
+    }
+
+    (*data)[*size] = '\0';
+    fclose(file);
+    return RX_SUCCESS;
+}
+
+static void
+rxp_records_destroy(struct rxp_records *records)
+{
+    RX_ASSERT(records != NULL);
+
+    RX_FREE(records->entries);
+    RX_FREE(records->data);
+}
+
+static enum rx_status
+rxp_records_load(struct rxp_records *records, const char *path)
+{
+    enum rx_status status;
+    size_t size;
+    size_t capacity;
+    char *it;
+
+    RX_ASSERT(records != NULL);
+    RX_ASSERT(path != NULL);
+
+    memset(records, 0, sizeof *records);
+
+    /* A missing file is expected the first time around. */
+    if (rxp_file_read(&records->data, &size, path) != RX_SUCCESS) {
+        RXP_LOG_INFO_1("no records could be loaded from `%s`\n", path);
+        return RX_SUCCESS;
+    }
+
+    /* The last line might not be terminated. */
+    capacity = size > 0 && records->data[size - 1] != '\n';
+    for (it = records->data; *it != '\0'; ++it) {
+        capacity += *it == '\n';
+    }
+
+    if (capacity == 0) {
+        return RX_SUCCESS;
+    }
+
+    records->entries = (struct rxp_record *)RX_MALLOC(
+        sizeof *records->entries * capacity);
+    if (records->entries == NULL) {
+        RXP_LOG_ERROR("failed to allocate the records\n");
+        status = RX_ERROR_ALLOCATION;
+        goto data_cleanup;
+    }
+
+    /* Split each line into fields in place. */
+    it = records->data;
+    while (*it != '\0') {
+        struct rxp_record *record;
+        char *line_end;
+        char *name;
+        char *value;
+
+        line_end = strchr(it, '\n');
+        if (line_end == NULL) {
+            line_end = it + strlen(it);
+        } else {
+            *line_end++ = '\0';
+        }
+
+        name = strchr(it, '\t');
+        value = name == NULL ? NULL : strchr(name + 1, '\t');
+        if (value == NULL) {
+            RXP_LOG_WARNING_1("ignoring a malformed record in `%s`\n", path);
+            it = line_end;
+            continue;
+        }
+
+        *name++ = '\0';
+        *value++ = '\0';
+
+        RX_ASSERT(records->count < capacity);
+        record = &records->entries[records->count];
+        if (rxp_str_to_uint64(&record->value, value) != RX_SUCCESS) {
+            RXP_LOG_WARNING_1("ignoring a malformed record in `%s`\n", path);
+            it = line_end;
+            continue;
+        }
+
+        record->suite_name = it;
+        record->name = name;
+        record->matched = 0;
+        ++records->count;
+
+        it = line_end;
+    }
+
+    qsort(records->entries,
+          records->count,
+          sizeof *records->entries,
+          rxp_compare_records);
+
+    return RX_SUCCESS;
+
+data_cleanup:
+    RX_FREE(records->data);
+    records->data = NULL;
+    return status;
+}
+
+static struct rxp_record *
+rxp_records_find(struct rxp_records *records,
+                 const struct rx_test_case *test_case)
+{
+    struct rxp_record key;
+
+    RX_ASSERT(records != NULL);
+    RX_ASSERT(test_case != NULL);
+
+    if (records->count == 0) {
+        return NULL;
+    }
+
+    key.suite_name = test_case->suite_name;
+    key.name = test_case->name;
+    return (struct rxp_record *)bsearch(&key,
+                                        records->entries,
+                                        records->count,
+                                        sizeof *records->entries,
+                                        rxp_compare_records);
+}
+
+static void
+rxp_record_write(FILE *file,
+                 const char *suite_name,
+                 const char *name,
+                 rx_uint64 value)
+{
+    /* Large enough to hold the 20 digits of the largest 64-bit integer. */
+    char digits[21];
+    char *it;
+
+    if (strpbrk(suite_name, "\t\n") != NULL || strpbrk(name, "\t\n") != NULL) {
+        RXP_LOG_WARNING_2("not recording the test case \"%s\" / \"%s\" since "
+                          "its name contains a tabulation or a new line\n",
+                          suite_name,
+                          name);
+        return;
+    }
+
+    it = &digits[sizeof digits - 1];
+    *it = '\0';
+    do {
+        *--it = (char)('0' + (int)(value % 10));
+        value /= 10;
+    } while (value != 0);
+
+    fprintf(file, "%s\t%s\t%s\n", suite_name, name, it);
+}
+
+/* Implementation: Timings                                         O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   The elapsed time of each test case, in nanoseconds, can be persisted to
+   a timing file to help scheduling the next runs.
+*/
+
+static enum rx_status
+rxp_timings_save(struct rxp_records *timings,
+                 const char *path,
+                 const struct rx_summary *summaries,
+                 size_t summary_count)
+{
+    FILE *file;
+    size_t i;
+
+    RX_ASSERT(timings != NULL);
+    RX_ASSERT(path != NULL);
+    RX_ASSERT(summaries != NULL);
+
+    file = fopen(path, "wb");
+    if (file == NULL) {
+        RXP_LOG_ERROR_1("failed to open the timing file `%s`\n", path);
+        return RX_ERROR;
+    }
+
+    for (i = 0; i < summary_count; ++i) {
+        const struct rx_summary *summary;
+        struct rxp_record *timing;
+
+        summary = &summaries[i];
+        timing = rxp_records_find(timings, summary->test_case);
+        if (timing != NULL) {
+            timing->matched = 1;
+        }
+
+        /* Don't lose the timings of the test cases that were skipped. */
+        if (summary->skipped) {
+            if (timing != NULL) {
+                rxp_record_write(
+                    file, timing->suite_name, timing->name, timing->value);
+            }
+
+            continue;
+        }
+
+        rxp_record_write(file,
+                         summary->test_case->suite_name,
+                         summary->test_case->name,
+                         summary->elapsed);
+    }
+
+    /* Keep the timings of the test cases that weren't part of this run. */
+    for (i = 0; i < timings->count; ++i) {
+        const struct rxp_record *timing;
+
+        timing = &timings->entries[i];
+        if (!timing->matched) {
+            rxp_record_write(
+                file, timing->suite_name, timing->name, timing->value);
+        }
+    }
+
+    if (fclose(file) != 0) {
+        RXP_LOG_ERROR_1("failed to write the timing file `%s`\n", path);
+        return RX_ERROR;
+    }
+
+    return RX_SUCCESS;
+}
+
+/* Implementation: Scheduler                                       O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   Test cases are distributed across the workers longest-first, using their
+   estimated durations, onto one queue per worker. Each worker pops its next
+   task from the front of its own queue and, once it runs dry, steals the
+   shortest task left from the back of the queue with the largest estimated
+   duration left.
+*/
+
+struct rxp_scheduler_task {
+    rx_uint64 estimate;
+    size_t index;
+    size_t worker;
+};
+
+struct rxp_scheduler_queue {
+    size_t begin;
+    size_t end;
+};
+
+struct rxp_scheduler {
+    size_t worker_count;
+    size_t remaining;
+    size_t *tasks;
+    rx_uint64 *estimates;
+    struct rxp_scheduler_queue *queues;
+    struct rxp_scheduler_task *sorted;
+    rx_uint64 *loads;
+};
+
+static int
+rxp_compare_scheduler_tasks(const void *a, const void *b)
+{
+    const struct rxp_scheduler_task *aa;
+    const struct rxp_scheduler_task *bb;
+
+    aa = (const struct rxp_scheduler_task *)a;
+    bb = (const struct rxp_scheduler_task *)b;
+
+    if (aa->estimate != bb->estimate) {
+        return aa->estimate > bb->estimate ? -1 : 1;
+    }
+
+    return aa->index < bb->index ? -1 : aa->index > bb->index;
+}
+
+static enum rx_status
+rxp_scheduler_create(struct rxp_scheduler *scheduler,
+                     size_t worker_count,
+                     size_t task_count)
+{
+    RX_ASSERT(scheduler != NULL);
+    RX_ASSERT(worker_count > 0);
+    RX_ASSERT(task_count > 0);
+
+    memset(scheduler, 0, sizeof *scheduler);
+    scheduler->worker_count = worker_count;
+
+    scheduler->tasks = (size_t *)RX_MALLOC(sizeof *scheduler->tasks
+                                           * task_count);
+    scheduler->estimates = (rx_uint64 *)RX_MALLOC(
+        sizeof *scheduler->estimates * task_count);
+    scheduler->sorted = (struct rxp_scheduler_task *)RX_MALLOC(
+        sizeof *scheduler->sorted * task_count);
+    scheduler->queues = (struct rxp_scheduler_queue *)RX_MALLOC(
+        sizeof *scheduler->queues * worker_count);
+    scheduler->loads = (rx_uint64 *)RX_MALLOC(sizeof *scheduler->loads
+                                              * worker_count);
+    if (scheduler->tasks == NULL || scheduler->estimates == NULL
+        || scheduler->sorted == NULL || scheduler->queues == NULL
+        || scheduler->loads == NULL) {
+        RXP_LOG_ERROR("failed to allocate the scheduler\n");
+        RX_FREE(scheduler->loads);
+        RX_FREE(scheduler->queues);
+        RX_FREE(scheduler->sorted);
+        RX_FREE(scheduler->estimates);
+        RX_FREE(scheduler->tasks);
+        return RX_ERROR_ALLOCATION;
+    }
+
+    memset(scheduler->queues, 0, sizeof *scheduler->queues * worker_count);
+    return RX_SUCCESS;
+}
+
+static void
+rxp_scheduler_destroy(struct rxp_scheduler *scheduler)
+{
+    RX_ASSERT(scheduler != NULL);
+
+    RX_FREE(scheduler->loads);
+    RX_FREE(scheduler->queues);
+    RX_FREE(scheduler->sorted);
+    RX_FREE(scheduler->estimates);
+    RX_FREE(scheduler->tasks);
+}
+
+static void
+rxp_scheduler_assign(struct rxp_scheduler *scheduler,
+                     const rx_uint64 *estimates,
+                     size_t first,
+                     size_t last)
+{
+    size_t count;
+    size_t offset;
+    size_t i;
+
+    RX_ASSERT(scheduler != NULL);
+    RX_ASSERT(first < last);
+
+    count = last - first;
+    for (i = 0; i < count; ++i) {
+        scheduler->sorted[i].estimate = estimates == NULL
+                                            ? 0
+                                            : estimates[first + i];
+        scheduler->sorted[i].index = first + i;
+    }
+
+    qsort(scheduler->sorted,
+          count,
+          sizeof *scheduler->sorted,
+          rxp_compare_scheduler_tasks);
+
+    for (i = 0; i < scheduler->worker_count; ++i) {
+        scheduler->queues[i].begin = 0;
+        scheduler->queues[i].end = 0;
+        scheduler->loads[i] = 0;
+    }
+
+    /*
+       Greedily assign each task to the least loaded worker, temporarily
+       reusing the `end` field of the queues to count their tasks.
+    */
+    for (i = 0; i < count; ++i) {
+        size_t worker;
+        size_t j;
+
+        worker = 0;
+        for (j = 1; j < scheduler->worker_count; ++j) {
+            if (scheduler->loads[j] < scheduler->loads[worker]
+                || (scheduler->loads[j] == scheduler->loads[worker]
+                    && scheduler->queues[j].end
+                           < scheduler->queues[worker].end)) {
+                worker = j;
+            }
+        }
+
+        scheduler->loads[worker] += scheduler->sorted[i].estimate;
+        ++scheduler->queues[worker].end;
+        scheduler->sorted[i].worker = worker;
+    }
+
+    offset = 0;
+    for (i = 0; i < scheduler->worker_count; ++i) {
+        scheduler->queues[i].begin = offset;
+        offset += scheduler->queues[i].end;
+        scheduler->queues[i].end = scheduler->queues[i].begin;
+    }
+
+    /*
+       The tasks being sorted, each queue ends up sorted longest-first, and
+       the load of each worker now tracks the estimates left in its queue.
+    */
+    for (i = 0; i < count; ++i) {
+        struct rxp_scheduler_queue *queue;
+
+        queue = &scheduler->queues[scheduler->sorted[i].worker];
+        scheduler->estimates[queue->end] = scheduler->sorted[i].estimate;
+        scheduler->tasks[queue->end++] = scheduler->sorted[i].index;
+    }
+
+    scheduler->remaining = count;
+}
+
+static int
+rxp_scheduler_pop(size_t *task,
+                  struct rxp_scheduler *scheduler,
+                  size_t worker)
+{
+    struct rxp_scheduler_queue *queue;
+    size_t victim;
+    size_t i;
+
+    RX_ASSERT(task != NULL);
+    RX_ASSERT(scheduler != NULL);
+    RX_ASSERT(worker < scheduler->worker_count);
+
+    if (scheduler->remaining == 0) {
+        return RXP_FALSE;
+    }
+
+    queue = &scheduler->queues[worker];
+    if (queue->begin < queue->end) {
+        scheduler->loads[worker] -= scheduler->estimates[queue->begin];
+        *task = scheduler->tasks[queue->begin++];
+        --scheduler->remaining;
+        return RXP_TRUE;
+    }
+
+    /* Ties, such as tasks without any estimate, go to the longest queue. */
+    victim = scheduler->worker_count;
+    for (i = 0; i < scheduler->worker_count; ++i) {
+        const struct rxp_scheduler_queue *candidate;
+
+        candidate = &scheduler->queues[i];
+        if (candidate->begin == candidate->end) {
+            continue;
+        }
+
+        if (victim == scheduler->worker_count
+            || scheduler->loads[i] > scheduler->loads[victim]
+            || (scheduler->loads[i] == scheduler->loads[victim]
+                && candidate->end - candidate->begin
+                       > scheduler->queues[victim].end
+                             - scheduler->queues[victim].begin)) {
+            victim = i;
+        }
+    }
+
+    RX_ASSERT(victim < scheduler->worker_count);
+
+    queue = &scheduler->queues[victim];
+    --queue->end;
+    scheduler->loads[victim] -= scheduler->estimates[queue->end];
+    *task = scheduler->tasks[queue->end];
+    --scheduler->remaining;
+    return RXP_TRUE;
+}
+
+/* Implementation: Data Pool                                       O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   Each worker keeps the fixture data blocks alive across its test cases,
+   with one block per power-of-two size class, to avoid allocating and freeing
+   a block for each test case. Since a worker only runs a single test case at
+   a time, one block per class is enough. Larger blocks aren't pooled.
+
+   Blocks are poisoned in debug builds, to surface the fixtures that rely on
+   the content left over by a previous test case, and are zeroed otherwise.
+   Fresh blocks are handled the same way, for the first test case of each size
+   class not to behave differently from the following ones.
+*/
+
+#define RXP_DATA_POOL_MIN_SIZE_LOG2 4
+#define RXP_DATA_POOL_CLASS_COUNT 9
+#define RXP_DATA_POOL_POISON 0xA5
+
+struct rxp_data_pool {
+    void *blocks[RXP_DATA_POOL_CLASS_COUNT];
+};
+
+static void
+rxp_data_pool_initialize(struct rxp_data_pool *pool)
+{
+    RX_ASSERT(pool != NULL);
+
+    memset(pool, 0, sizeof *pool);
+}
+
+static void
+rxp_data_pool_terminate(struct rxp_data_pool *pool)
+{
+    size_t i;
+
+    RX_ASSERT(pool != NULL);
+
+    for (i = 0; i < RXP_DATA_POOL_CLASS_COUNT; ++i) {
+        RX_FREE(pool->blocks[i]);
+        pool->blocks[i] = NULL;
+    }
+}
+
+static int
+rxp_data_pool_get_class(size_t *index, size_t size)
+{
+    size_t class_size;
+
+    RX_ASSERT(index != NULL);
+
+    class_size = (size_t)1 << RXP_DATA_POOL_MIN_SIZE_LOG2;
+    for (*index = 0; *index < RXP_DATA_POOL_CLASS_COUNT; ++*index) {
+        if (size <= class_size) {
+            return RXP_TRUE;
+        }
+
+        class_size <<= 1;
+    }
+
+    return RXP_FALSE;
+}
+
+static void *
+rxp_data_pool_acquire(struct rxp_data_pool *pool, size_t size)
+{
+    size_t index;
+    void *data;
+
+    RX_ASSERT(size > 0);
+
+    if (pool == NULL || !rxp_data_pool_get_class(&index, size)) {
+        data = RX_MALLOC(size);
+    } else if (pool->blocks[index] == NULL) {
+        /* Allocate the whole class for the block to be reused by any size. */
+        data = RX_MALLOC((size_t)1 << (RXP_DATA_POOL_MIN_SIZE_LOG2 + index));
+    } else {
+        data = pool->blocks[index];
+        pool->blocks[index] = NULL;
+    }
+
+    if (data == NULL) {
+        return NULL;
+    }
+
+#if RXP_DEBUGGING
+    memset(data, RXP_DATA_POOL_POISON, size);
+#else
+    memset(data, 0, size);
+#endif
+
+    return data;
+}
+
+static void
+rxp_data_pool_release(struct rxp_data_pool *pool, void *data, size_t size)
+{
+    size_t index;
+
+    if (data == NULL) {
+        return;
+    }
+
+    if (pool == NULL || !rxp_data_pool_get_class(&index, size)
+        || pool->blocks[index] != NULL) {
+        RX_FREE(data);
+        return;
+    }
+
+    pool->blocks[index] = data;
+}
+
+/* Implementation: Data Blocks                                     O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   Fixture data is allocated from the worker's pool unless the fixture asks
+   for a specific alignment or for huge pages. Aligned blocks are carved out
+   of a larger allocation to keep honouring `RX_MALLOC`. Huge pages are first
+   requested explicitly, then through transparent huge pages by mapping
+   a block aligned on their size, and fall back to an aligned allocation if
+   neither is available.
+
+   Guarded blocks are surrounded with inaccessible pages and end as close as
+   possible to the trailing one, so that out-of-bounds accesses fault right
+   away. They still need to be aligned for any type that the data might hold,
+   hence the padding at the end when the size isn't a multiple of the
+   alignment.
+*/
+
+#define RXP_HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+
+union rxp_max_align {
+    long double a;
+    double b;
+    rx_uint64 c;
+    void *d;
+    void (*e)(void);
+};
+
+struct rxp_max_align_probe {
+    char c;
+    union rxp_max_align value;
+};
+
+#define RXP_MAX_ALIGNMENT offsetof(struct rxp_max_align_probe, value)
+
+static size_t
+rxp_round_up(size_t value, size_t alignment)
+{
+    RX_ASSERT(alignment > 0);
+
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+#if RXP_HAS_MMAP
+static void *
+rxp_pages_map(size_t size)
+{
+    void *pages;
+
+    RX_ASSERT(size > 0);
+
+#if defined(MAP_ANONYMOUS)
+    pages = mmap(NULL,
+                 size,
+                 PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS,
+                 -1,
+                 0);
+#elif defined(MAP_ANON)
+    pages = mmap(
+        NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+#else
+    {
+        int fd;
+
+        /* Anonymous mappings aren't part of older POSIX versions. */
+        fd = open("/dev/zero", O_RDWR);
+        if (fd < 0) {
+            return NULL;
+        }
+
+        pages = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+    }
+#endif
+
+    return pages == MAP_FAILED ? NULL : pages;
+}
+
+static enum rx_status
+rxp_data_block_map_huge_pages(struct rxp_data_block *block)
+{
+    size_t size;
+    size_t mapped_size;
+    size_t head;
+    char *pages;
+    char *data;
+
+    RX_ASSERT(block != NULL);
+
+    size = rxp_round_up(block->size, RXP_HUGE_PAGE_SIZE);
+
+#if defined(MAP_ANONYMOUS) && defined(MAP_HUGETLB)
+    pages = (char *)mmap(NULL,
+                         size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+                         -1,
+                         0);
+    if (pages != MAP_FAILED) {
+        block->data = pages;
+        block->base = pages;
+        block->base_size = size;
+        block->kind = RXP_DATA_BLOCK_MAPPED;
+        return RX_SUCCESS;
+    }
+#endif
+
+    /* Transparent huge pages require the mapping to be aligned. */
+    mapped_size = size + RXP_HUGE_PAGE_SIZE;
+    pages = (char *)rxp_pages_map(mapped_size);
+    if (pages == NULL) {
+        return RX_ERROR;
+    }
+
+    data = (char *)(uintptr_t)rxp_round_up((size_t)(uintptr_t)pages,
+                                           RXP_HUGE_PAGE_SIZE);
+    head = (size_t)(data - pages);
+    if (head > 0) {
+        munmap(pages, head);
+    }
+
+    if (mapped_size - head > size) {
+        munmap(data + size, mapped_size - head - size);
+    }
+
+#if defined(MADV_HUGEPAGE)
+    madvise(data, size, MADV_HUGEPAGE);
+#endif
+
+    block->data = data;
+    block->base = data;
+    block->base_size = size;
+    block->kind = RXP_DATA_BLOCK_MAPPED;
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_data_block_map_guarded(struct rxp_data_block *block, size_t alignment)
+{
+    long value;
+    size_t page_size;
+    size_t size;
+    char *pages;
+
+    RX_ASSERT(block != NULL);
+    RX_ASSERT(alignment > 0);
+
+    value = sysconf(_SC_PAGESIZE);
+    if (value <= 0) {
+        return RX_ERROR;
+    }
+
+    page_size = (size_t)value;
+    if (alignment > page_size) {
+        return RX_ERROR;
+    }
+
+    size = rxp_round_up(block->size, alignment);
+    block->base_size = rxp_round_up(size, page_size) + 2 * page_size;
+    pages = (char *)rxp_pages_map(block->base_size);
+    if (pages == NULL) {
+        return RX_ERROR;
+    }
+
+    if (mprotect(pages, page_size, PROT_NONE) != 0
+        || mprotect(pages + block->base_size - page_size, page_size, PROT_NONE)
+               != 0) {
+        munmap(pages, block->base_size);
+        return RX_ERROR;
+    }
+
+    block->data = pages + block->base_size - page_size - size;
+    block->base = pages;
+    block->kind = RXP_DATA_BLOCK_GUARDED;
+    return RX_SUCCESS;
+}
+#endif /* RXP_HAS_MMAP */
+
+static enum rx_status
+rxp_data_block_allocate(struct rxp_data_block *block,
+                        struct rxp_data_pool *pool,
+                        size_t size,
+                        const struct rx_fixture_config *config)
+{
+    size_t alignment;
+
+    RX_ASSERT(block != NULL);
+    RX_ASSERT(config != NULL);
+
+    memset(block, 0, sizeof *block);
+    block->size = size;
+
+    if (size == 0) {
+        return RX_SUCCESS;
+    }
+
+    alignment = (size_t)config->alignment;
+    if ((alignment & (alignment - 1)) != 0) {
+        RXP_LOG_ERROR_1("the fixture alignment %lu is not a power of two\n",
+                        (unsigned long)alignment);
+        return RX_ERROR;
+    }
+
+    if (config->guard_pages) {
+#if RXP_HAS_MMAP
+        if (rxp_data_block_map_guarded(block,
+                                       alignment > RXP_MAX_ALIGNMENT
+                                           ? alignment
+                                           : RXP_MAX_ALIGNMENT)
+            == RX_SUCCESS) {
+            return RX_SUCCESS;
+        }
+#endif
+
+        RXP_LOG_WARNING("guard pages are not available, falling back to "
+                        "a regular allocation\n");
+    } else if (config->huge_pages) {
+#if RXP_HAS_MMAP
+        if (rxp_data_block_map_huge_pages(block) == RX_SUCCESS) {
+            return RX_SUCCESS;
+        }
+#endif
+
+        RXP_LOG_DEBUG("huge pages are not available, falling back to "
+                      "a regular allocation\n");
+    } else if (alignment == 0) {
+        block->data = rxp_data_pool_acquire(pool, size);
+        if (block->data == NULL) {
+            return RX_ERROR_ALLOCATION;
+        }
+
+        block->kind = RXP_DATA_BLOCK_POOLED;
+        return RX_SUCCESS;
+    }
+
+    if (alignment == 0) {
+        alignment = 1;
+    }
+
+    block->base_size = size + alignment - 1;
+    block->base = RX_MALLOC(block->base_size);
+    if (block->base == NULL) {
+        return RX_ERROR_ALLOCATION;
+    }
+
+    block->data = (void *)(uintptr_t)rxp_round_up(
+        (size_t)(uintptr_t)block->base, alignment);
+    block->kind = RXP_DATA_BLOCK_ALIGNED;
+    return RX_SUCCESS;
+}
+
+static void
+rxp_data_block_free(struct rxp_data_block *block, struct rxp_data_pool *pool)
+{
+    RX_ASSERT(block != NULL);
+
+    switch (block->kind) {
+        case RXP_DATA_BLOCK_POOLED:
+            rxp_data_pool_release(pool, block->data, block->size);
+            break;
+        case RXP_DATA_BLOCK_ALIGNED:
+            RX_FREE(block->base);
+            break;
+#if RXP_HAS_MMAP
+        case RXP_DATA_BLOCK_MAPPED:
+        case RXP_DATA_BLOCK_GUARDED:
+            munmap(block->base, block->base_size);
+            break;
+#endif
+        default:
+            break;
+    }
+
+    memset(block, 0, sizeof *block);
+}
+
+/* Implementation: Benchmarks                                      O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   The loop of a benchmark runs its body in batches of iterations that are
+   timed as a whole, for the cost of reading the clock to be amortized. The
+   number of iterations per batch is first calibrated for a batch to last at
+   least the minimum time, then a few batches are run to warm up the caches
+   and the branch predictors, before running the batches being sampled.
+
+   Benchmarks are skipped unless enabled, and the loop runs its body only once
+   outside of an enabled benchmark.
+*/
+
+#define RXP_BENCHMARK_WARM_UP_COUNT 2
+#define RXP_BENCHMARK_MAX_ITERATION_COUNT ((rx_uint64)1 << 40)
+
+enum rxp_benchmark_phase {
+    RXP_BENCHMARK_PHASE_ONCE = 0,
+    RXP_BENCHMARK_PHASE_CALIBRATING = 1,
+    RXP_BENCHMARK_PHASE_WARMING_UP = 2,
+    RXP_BENCHMARK_PHASE_SAMPLING = 3,
+    RXP_BENCHMARK_PHASE_DONE = 4
+};
+
+struct rxp_benchmark {
+    /* Iterations left in the current batch, decremented by the loop when it
+       cannot declare its own counter. */
+    rx_uint64 remaining;
+    int enabled;
+    int running;
+    enum rxp_benchmark_phase phase;
+    rx_uint64 iteration_count;
+    uint64_t started;
+    uint64_t min_time;
+    const struct rxp_clock *clock;
+    size_t round;
+    size_t sample_count;
+    double *samples;
+    struct rx_benchmark_stats *stats;
+};
+
+static int
+rxp_test_case_is_skipped(const struct rx_test_case *test_case)
+{
+    RX_ASSERT(test_case != NULL);
+
+    return test_case->config.skip
+           || (test_case->benchmark && !rxp_settings_instance.benchmark);
+}
+
+static void
+rxp_benchmark_initialize(struct rxp_benchmark *benchmark,
+                         const struct rx_test_case *test_case,
+                         const struct rxp_settings *settings,
+                         struct rx_benchmark_stats *stats)
+{
+    RX_ASSERT(benchmark != NULL);
+    RX_ASSERT(test_case != NULL);
+    RX_ASSERT(settings != NULL);
+    RX_ASSERT(stats != NULL);
+
+    /* The loop runs in the translation unit of the test case, so it reads
+       the settings and the clock of the runner from here. */
+    memset(benchmark, 0, sizeof *benchmark);
+    benchmark->enabled = test_case->benchmark && settings->benchmark;
+    benchmark->phase = RXP_BENCHMARK_PHASE_DONE;
+    benchmark->min_time = (uint64_t)settings->benchmark_min_time_ms
+                          * (RXP_TICKS_PER_SECOND / 1000);
+    benchmark->sample_count = settings->benchmark_sample_count;
+    benchmark->clock = settings->clock;
+    benchmark->stats = stats;
+}
+
+static void
+rxp_benchmark_terminate(struct rxp_benchmark *benchmark)
+{
+    RX_ASSERT(benchmark != NULL);
+
+    RX_FREE(benchmark->samples);
+    benchmark->samples = NULL;
+}
+
+static int
+rxp_compare_doubles(const void *a, const void *b)
+{
+    double aa;
+    double bb;
+
+    aa = *(const double *)a;
+    bb = *(const double *)b;
+    return (aa > bb) - (aa < bb);
+}
+
+static double
+rxp_sqrt(double x)
+{
+    double y;
+    int i;
+
+    if (x <= 0.0) {
+        return 0.0;
+    }
+
+    /* Newton's method converges quickly enough from any positive guess. */
+    y = x < 1.0 ? 1.0 : x;
+    for (i = 0; i < 64; ++i) {
+        double next;
+
+        next = 0.5 * (y + x / y);
+        if (!(next < y)) {
+            break;
+        }
+
+        y = next;
+    }
+
+    return y;
+}
+
+static void
+rxp_benchmark_compute_stats(struct rxp_benchmark *benchmark, size_t count)
+{
+    struct rx_benchmark_stats *stats;
+    double *samples;
+    double sum;
+    double variance;
+    size_t i;
+
+    RX_ASSERT(benchmark != NULL);
+    RX_ASSERT(benchmark->samples != NULL);
+    RX_ASSERT(count > 0 && count <= benchmark->sample_count);
+
+    stats = benchmark->stats;
+    samples = benchmark->samples;
+
+    qsort(samples, count, sizeof *samples, rxp_compare_doubles);
+
+    sum = 0.0;
+    for (i = 0; i < count; ++i) {
+        sum += samples[i];
+    }
+
+    stats->sample_count = (rx_size)count;
+    stats->iteration_count = benchmark->iteration_count;
+    stats->min = samples[0];
+    stats->median = count & 1 ? samples[count / 2]
+                              : (samples[count / 2 - 1] + samples[count / 2])
+                                    * 0.5;
+    stats->mean = sum / (double)count;
+
+    variance = 0.0;
+    for (i = 0; i < count; ++i) {
+        variance += (samples[i] - stats->mean) * (samples[i] - stats->mean);
+    }
+
+    stats->stddev
+        = count > 1 ? rxp_sqrt(variance / (double)(count - 1)) : 0.0;
+
+    /* Nearest-rank percentile. */
+    stats->p99 = samples[(count * 99 + 99) / 100 - 1];
+}
+
+static void
+rxp_benchmark_record(struct rxp_benchmark *benchmark, uint64_t elapsed)
+{
+    uint64_t min_time;
+
+    RX_ASSERT(benchmark != NULL);
+
+    min_time = benchmark->min_time;
+
+    switch (benchmark->phase) {
+        case RXP_BENCHMARK_PHASE_CALIBRATING:
+            if (elapsed >= min_time
+                || benchmark->iteration_count
+                       >= RXP_BENCHMARK_MAX_ITERATION_COUNT) {
+                benchmark->phase = RXP_BENCHMARK_PHASE_WARMING_UP;
+                benchmark->round = 0;
+            } else {
+                rx_uint64 count;
+
+                /* Aim slightly above the minimum time when the elapsed time
+                   is significant enough for an estimate to be reliable. */
+                if (elapsed * 10 <= min_time) {
+                    count = benchmark->iteration_count * 10;
+                } else {
+                    count = (rx_uint64)((double)benchmark->iteration_count
+                                        * (double)min_time * 1.4
+                                        / (double)elapsed);
+                }
+
+                if (count <= benchmark->iteration_count) {
+                    count = benchmark->iteration_count + 1;
+                }
+
+                benchmark->iteration_count
+                    = count > RXP_BENCHMARK_MAX_ITERATION_COUNT
+                          ? RXP_BENCHMARK_MAX_ITERATION_COUNT
+                          : count;
+            }
+
+            return;
+        case RXP_BENCHMARK_PHASE_WARMING_UP:
+            ++benchmark->round;
+            if (benchmark->round >= RXP_BENCHMARK_WARM_UP_COUNT) {
+                benchmark->phase = RXP_BENCHMARK_PHASE_SAMPLING;
+                benchmark->round = 0;
+            }
+
+            return;
+        case RXP_BENCHMARK_PHASE_SAMPLING:
+            benchmark->samples[benchmark->round]
+                = (double)elapsed / (double)benchmark->iteration_count;
+            ++benchmark->round;
+            if (benchmark->round >= benchmark->sample_count) {
+                benchmark->phase = RXP_BENCHMARK_PHASE_DONE;
+            }
+
+            return;
+        case RXP_BENCHMARK_PHASE_ONCE:
+        case RXP_BENCHMARK_PHASE_DONE:
+        default:
+            RX_ASSERT(0);
+            return;
+    }
+}
+
+static void
+rxp_benchmark_fail(struct rx_context *context, const char *msg)
+{
+    RX_ASSERT(context != NULL);
+    RX_ASSERT(context->benchmark != NULL);
+
+    /* Stop the loop rather than passing without any statistics. */
+    context->benchmark->running = RXP_FALSE;
+    context->benchmark->phase = RXP_BENCHMARK_PHASE_DONE;
+    rx_handle_test_result(context,
+                          RXP_FALSE,
+                          context->file == NULL ? "<unknown>" : context->file,
+                          context->line,
+                          RX_FATAL,
+                          msg,
+                          NULL);
+}
+
+RXP_MAYBE_UNUSED static rx_uint64
+rxp_benchmark_start(struct rx_context *context)
+{
+    struct rxp_benchmark *benchmark;
+
+    RX_ASSERT(context != NULL);
+    RX_ASSERT(context->benchmark != NULL);
+
+    benchmark = context->benchmark;
+    benchmark->running = RXP_FALSE;
+    benchmark->phase = RXP_BENCHMARK_PHASE_ONCE;
+
+    if (!benchmark->enabled) {
+        return 0;
+    }
+
+    if (benchmark->samples == NULL) {
+        benchmark->samples = (double *)RX_MALLOC(sizeof *benchmark->samples
+                                                 * benchmark->sample_count);
+        if (benchmark->samples == NULL) {
+            rxp_benchmark_fail(context,
+                               "failed to allocate the benchmark samples");
+            return 0;
+        }
+    }
+
+    benchmark->phase = RXP_BENCHMARK_PHASE_CALIBRATING;
+    benchmark->iteration_count = 1;
+    benchmark->round = 0;
+    return 0;
+}
+
+/* Returns the size of the next batch of iterations, if any, given the count
+   left from the previous one. */
+RXP_MAYBE_UNUSED static rx_uint64
+rxp_benchmark_advance(struct rx_context *context, rx_uint64 left)
+{
+    struct rxp_benchmark *benchmark;
+
+    RX_ASSERT(context != NULL);
+    RX_ASSERT(context->benchmark != NULL);
+
+    benchmark = context->benchmark;
+
+    if (benchmark->phase == RXP_BENCHMARK_PHASE_ONCE) {
+        benchmark->phase = RXP_BENCHMARK_PHASE_DONE;
+        return 1;
+    }
+
+    if (benchmark->phase == RXP_BENCHMARK_PHASE_DONE) {
+        return 0;
+    }
+
+    if (benchmark->running) {
+        uint64_t now;
+
+        if (rxp_clock_get_time(benchmark->clock, &now) != RX_SUCCESS) {
+            rxp_benchmark_fail(context, "failed to time the benchmark");
+            return 0;
+        }
+
+        /* The loop only wraps the count around when running the batch to
+           completion, otherwise a `break` ended the benchmark, and the
+           partial batch is dropped. */
+        if (left != (rx_uint64)-1) {
+            benchmark->running = RXP_FALSE;
+            if (benchmark->phase == RXP_BENCHMARK_PHASE_SAMPLING
+                && benchmark->round > 0) {
+                rxp_benchmark_compute_stats(benchmark, benchmark->round);
+            }
+
+            benchmark->phase = RXP_BENCHMARK_PHASE_DONE;
+            return 0;
+        }
+
+        RX_ASSERT(now >= benchmark->started);
+        rxp_benchmark_record(benchmark, now - benchmark->started);
+        if (benchmark->phase == RXP_BENCHMARK_PHASE_DONE) {
+            benchmark->running = RXP_FALSE;
+            rxp_benchmark_compute_stats(benchmark, benchmark->sample_count);
+            return 0;
+        }
+    }
+
+    benchmark->running = RXP_TRUE;
+
+    /* Read the clock last to leave the setup out of the measure. */
+    if (rxp_clock_get_time(benchmark->clock, &benchmark->started)
+        != RX_SUCCESS) {
+        rxp_benchmark_fail(context, "failed to time the benchmark");
+        return 0;
+    }
+
+    return benchmark->iteration_count;
+}
+
+/* Implementation: Shared Fixtures                                 O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   The data of a shared fixture is set up by the first test case of its suite
+   to run, and torn down once the last one completes. Each process keeps its
+   own instances, meaning that the worker processes and the isolated child
+   processes set up their own ones, while the worker threads share them.
+*/
+
+struct rxp_shared_fixture {
+    const struct rx_test_case *test_case;
+    struct rx_fixture fixture;
+    struct rxp_data_block block;
+    enum rx_status status;
+    int ready;
+    size_t total;
+    size_t remaining;
+};
+
+struct rxp_shared_fixtures {
+    struct rxp_shared_fixture *entries;
+    size_t count;
+};
+
+static struct rxp_shared_fixtures rxp_shared_fixtures_instance = {NULL, 0};
+
+#if RXP_HAS_THREADS
+static pthread_mutex_t rxp_fixtures_mutex = PTHREAD_MUTEX_INITIALIZER;
+    #define RXP_FIXTURES_LOCK()                                                \
+        pthread_mutex_lock(&rxp_fixtures_mutex)
+    #define RXP_FIXTURES_UNLOCK()                                              \
+        pthread_mutex_unlock(&rxp_fixtures_mutex)
+#else
+    #define RXP_FIXTURES_LOCK()
+    #define RXP_FIXTURES_UNLOCK()
+#endif
+
+static int
+rxp_shared_fixture_match(const struct rxp_shared_fixture *shared_fixture,
+                         const struct rx_test_case *test_case)
+{
+    const struct rx_fixture *fixture;
+
+    RX_ASSERT(shared_fixture != NULL);
+    RX_ASSERT(test_case != NULL);
+
+    fixture = &test_case->config.shared_fixture;
+    return strcmp(shared_fixture->test_case->suite_name, test_case->suite_name)
+               == 0
+           && shared_fixture->fixture.size == fixture->size
+           && shared_fixture->fixture.config.set_up == fixture->config.set_up
+           && shared_fixture->fixture.config.tear_down
+                  == fixture->config.tear_down;
+}
+
+static struct rxp_shared_fixture *
+rxp_shared_fixtures_find(const struct rxp_shared_fixtures *shared_fixtures,
+                         const struct rx_test_case *test_case)
+{
+    size_t i;
+
+    RX_ASSERT(shared_fixtures != NULL);
+    RX_ASSERT(test_case != NULL);
+
+    for (i = 0; i < shared_fixtures->count; ++i) {
+        if (rxp_shared_fixture_match(&shared_fixtures->entries[i], test_case)) {
+            return &shared_fixtures->entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void
+rxp_shared_fixture_initialize(struct rxp_shared_fixture *shared_fixture,
+                              const struct rx_test_case *test_case)
+{
+    RX_ASSERT(shared_fixture != NULL);
+    RX_ASSERT(test_case != NULL);
+
+    memset(shared_fixture, 0, sizeof *shared_fixture);
+    shared_fixture->test_case = test_case;
+    shared_fixture->fixture = test_case->config.shared_fixture;
+    shared_fixture->status = RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_shared_fixtures_create(struct rxp_shared_fixtures *shared_fixtures,
+                           size_t test_case_count,
+                           const struct rx_test_case *test_cases)
+{
+    size_t i;
+
+    RX_ASSERT(shared_fixtures != NULL);
+    RX_ASSERT(test_cases != NULL);
+
+    memset(shared_fixtures, 0, sizeof *shared_fixtures);
+
+    for (i = 0; i < test_case_count; ++i) {
+        struct rxp_shared_fixture *shared_fixture;
+
+        if (rxp_test_case_is_skipped(&test_cases[i])
+            || !rxp_fixture_is_set(&test_cases[i].config.shared_fixture)) {
+            continue;
+        }
+
+        shared_fixture
+            = rxp_shared_fixtures_find(shared_fixtures, &test_cases[i]);
+        if (shared_fixture == NULL) {
+            /* Allocate lazily since most runs don't have any. */
+            if (shared_fixtures->entries == NULL) {
+                shared_fixtures->entries = (struct rxp_shared_fixture *)
+                    RX_MALLOC(sizeof *shared_fixtures->entries
+                              * test_case_count);
+                if (shared_fixtures->entries == NULL) {
+                    RXP_LOG_ERROR("failed to allocate the shared "
+                                  "fixtures\n");
+                    return RX_ERROR_ALLOCATION;
+                }
+            }
+
+            shared_fixture = &shared_fixtures->entries[shared_fixtures->count];
+            rxp_shared_fixture_initialize(shared_fixture, &test_cases[i]);
+            ++shared_fixtures->count;
+        }
+
+        ++shared_fixture->total;
+    }
+
+    return RX_SUCCESS;
+}
+
+static void
+rxp_shared_fixtures_rewind(struct rxp_shared_fixtures *shared_fixtures)
+{
+    size_t i;
+
+    RX_ASSERT(shared_fixtures != NULL);
+
+    for (i = 0; i < shared_fixtures->count; ++i) {
+        shared_fixtures->entries[i].remaining
+            = shared_fixtures->entries[i].total;
+    }
+}
+
+static enum rx_status
+rxp_shared_fixture_acquire(void **data,
+                           struct rxp_shared_fixture *shared_fixture,
+                           struct rx_context *context)
+{
+    enum rx_status status;
+
+    RX_ASSERT(data != NULL);
+    RX_ASSERT(shared_fixture != NULL);
+    RX_ASSERT(context != NULL);
+
+    RXP_FIXTURES_LOCK();
+
+    if (!shared_fixture->ready) {
+        shared_fixture->ready = 1;
+        shared_fixture->status
+            = rxp_data_block_allocate(&shared_fixture->block,
+                                      NULL,
+                                      shared_fixture->fixture.size,
+                                      &shared_fixture->fixture.config);
+        if (shared_fixture->status != RX_SUCCESS) {
+            RXP_LOG_ERROR_1("failed to allocate the shared data "
+                            "(suite: \"%s\")\n",
+                            shared_fixture->test_case->suite_name);
+        }
+
+        /* A failure is remembered to not set up the fixture over again. */
+        if (shared_fixture->status == RX_SUCCESS
+            && shared_fixture->fixture.config.set_up != NULL) {
+            shared_fixture->status = shared_fixture->fixture.config.set_up(
+                context, shared_fixture->block.data);
+            if (shared_fixture->status != RX_SUCCESS) {
+                RXP_LOG_ERROR_1("failed to set-up the shared fixture "
+                                "(suite: \"%s\")\n",
+                                shared_fixture->test_case->suite_name);
+            }
+        }
+    }
+
+    status = shared_fixture->status;
+    *data = shared_fixture->block.data;
+
+    RXP_FIXTURES_UNLOCK();
+    return status;
+}
+
+static void
+rxp_shared_fixture_tear_down(struct rxp_shared_fixture *shared_fixture,
+                             struct rx_context *context)
+{
+    RX_ASSERT(shared_fixture != NULL);
+    RX_ASSERT(context != NULL);
+
+    if (shared_fixture->status == RX_SUCCESS
+        && shared_fixture->fixture.config.tear_down != NULL) {
+        shared_fixture->fixture.config.tear_down(context,
+                                                 shared_fixture->block.data);
+    }
+
+    rxp_data_block_free(&shared_fixture->block, NULL);
+    shared_fixture->status = RX_SUCCESS;
+    shared_fixture->ready = 0;
+}
+
+static void
+rxp_shared_fixture_release(struct rxp_shared_fixture *shared_fixture,
+                           struct rx_context *context)
+{
+    RX_ASSERT(shared_fixture != NULL);
+    RX_ASSERT(context != NULL);
+
+    RXP_FIXTURES_LOCK();
+
+    if (shared_fixture->remaining > 0) {
+        --shared_fixture->remaining;
+    }
+
+    if (shared_fixture->remaining == 0 && shared_fixture->ready) {
+        rxp_shared_fixture_tear_down(shared_fixture, context);
+    }
+
+    RXP_FIXTURES_UNLOCK();
+}
+
+static void
+rxp_shared_fixtures_tear_down(struct rxp_shared_fixtures *shared_fixtures)
+{
+    size_t i;
+
+    RX_ASSERT(shared_fixtures != NULL);
+
+    /*
+       Tear down the shared fixtures whose test cases didn't all run in this
+       process, that is when running in a child process or when cancelled.
+    */
+    for (i = 0; i < shared_fixtures->count; ++i) {
+        struct rxp_shared_fixture *shared_fixture;
+        struct rx_summary summary;
+        struct rx_context context;
+
+        shared_fixture = &shared_fixtures->entries[i];
+        if (!shared_fixture->ready) {
+            continue;
+        }
+
+        if (rx_summary_initialize(&summary, shared_fixture->test_case)
+            != RX_SUCCESS) {
+            continue;
+        }
+
+        memset(&context, 0, sizeof context);
+        context.summary = &summary;
+        rxp_shared_fixture_tear_down(shared_fixture, &context);
+        rx_summary_terminate(&summary);
+    }
+}
+
+static void
+rxp_shared_fixtures_destroy(struct rxp_shared_fixtures *shared_fixtures)
+{
+    RX_ASSERT(shared_fixtures != NULL);
+
+    rxp_shared_fixtures_tear_down(shared_fixtures);
+    RX_FREE(shared_fixtures->entries);
+    shared_fixtures->entries = NULL;
+    shared_fixtures->count = 0;
+}
+
+/* Implementation: Session Fixtures                                O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   The data of a session fixture is set up by the first test case depending on
+   it, if any, and is kept until the end of the run. As with shared fixtures,
+   each process keeps its own instances.
+*/
+
+static enum rx_status
+rxp_session_fixture_acquire(void **data,
+                            struct rx_session_fixture *session_fixture,
+                            struct rx_context *context)
+{
+    enum rx_status status;
+
+    RX_ASSERT(data != NULL);
+    RX_ASSERT(session_fixture != NULL);
+    RX_ASSERT(context != NULL);
+
+    RXP_FIXTURES_LOCK();
+
+    if (!session_fixture->ready) {
+        session_fixture->ready = 1;
+        memset(&session_fixture->config, 0, sizeof session_fixture->config);
+
+        if (session_fixture->update != NULL) {
+            session_fixture->update(&session_fixture->config);
+        }
+
+        session_fixture->status
+            = rxp_data_block_allocate(&session_fixture->block,
+                                      NULL,
+                                      session_fixture->size,
+                                      &session_fixture->config);
+        if (session_fixture->status != RX_SUCCESS) {
+            RXP_LOG_ERROR_1("failed to allocate the session data "
+                            "(fixture: \"%s\")\n",
+                            session_fixture->name);
+        }
+
+        /* A failure is remembered to not set up the fixture over again. */
+        if (session_fixture->status == RX_SUCCESS
+            && session_fixture->config.set_up != NULL) {
+            session_fixture->status = session_fixture->config.set_up(
+                context, session_fixture->block.data);
+            if (session_fixture->status != RX_SUCCESS) {
+                RXP_LOG_ERROR_1("failed to set-up the session fixture "
+                                "(fixture: \"%s\")\n",
+                                session_fixture->name);
+            }
+        }
+    }
+
+    status = session_fixture->status;
+    *data = session_fixture->block.data;
+
+    RXP_FIXTURES_UNLOCK();
+    return status;
+}
+
+static void
+rxp_session_fixture_tear_down(struct rx_session_fixture *session_fixture)
+{
+    struct rx_test_case test_case;
+    struct rx_summary summary;
+    struct rx_context context;
+
+    RX_ASSERT(session_fixture != NULL);
+
+    if (!session_fixture->ready) {
+        return;
+    }
+
+    if (session_fixture->status == RX_SUCCESS
+        && session_fixture->config.tear_down != NULL) {
+        /* Any failure reported by the tear-down is discarded. */
+        memset(&test_case, 0, sizeof test_case);
+        test_case.suite_name = session_fixture->name;
+        test_case.name = session_fixture->name;
+
+        if (rx_summary_initialize(&summary, &test_case) == RX_SUCCESS) {
+            memset(&context, 0, sizeof context);
+            context.summary = &summary;
+            session_fixture->config.tear_down(&context,
+                                              session_fixture->block.data);
+            rx_summary_terminate(&summary);
+        }
+    }
+
+    rxp_data_block_free(&session_fixture->block, NULL);
+    session_fixture->status = RX_SUCCESS;
+    session_fixture->ready = 0;
+}
+
+static void
+rxp_session_fixtures_tear_down(size_t test_case_count,
+                               const struct rx_test_case *test_cases)
+{
+#if RXP_TEST_DISCOVERY
+    struct rx_session_fixture * const *it;
+
+    RXP_UNUSED(test_case_count);
+    RXP_UNUSED(test_cases);
+
+    for (it = RXP_SESSION_FIXTURE_SECTION_BEGIN;
+         it != RXP_SESSION_FIXTURE_SECTION_END;
+         ++it) {
+        if (*it != NULL) {
+            rxp_session_fixture_tear_down(*it);
+        }
+    }
+#else
+    size_t i;
+
+    RX_ASSERT(test_cases != NULL || test_case_count == 0);
+
+    /* Without any section to iterate over, look up the test cases instead. */
+    for (i = 0; i < test_case_count; ++i) {
+        if (test_cases[i].config.session_fixture != NULL) {
+            rxp_session_fixture_tear_down(test_cases[i].config.session_fixture);
+        }
+    }
+#endif
+}
+
+/* Implementation: Snapshots                                       O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   Fixtures flagged with the `snapshot` option are set up only once per
+   process, into a snapshot whose content is then copied into the data of
+   each test case, in place of running the set-up function again. The
+   tear-down function is run once on the snapshot at the end of the run.
+*/
+
+struct rxp_snapshot {
+    struct rx_fixture fixture;
+    struct rxp_data_block block;
+    enum rx_status status;
+};
+
+struct rxp_snapshots {
+    struct rxp_snapshot *entries;
+    size_t count;
+};
+
+static struct rxp_snapshots rxp_snapshots_instance = {NULL, 0};
+
+static int
+rxp_fixture_uses_snapshot(const struct rx_fixture *fixture)
+{
+    RX_ASSERT(fixture != NULL);
+
+    return fixture->config.snapshot && fixture->size > 0;
+}
+
+static enum rx_status
+rxp_snapshot_restore(void *data,
+                     const struct rx_fixture *fixture,
+                     struct rx_context *context)
+{
+    enum rx_status status;
+    struct rxp_snapshot *snapshot;
+    const void *snapshot_data;
+    size_t i;
+
+    RX_ASSERT(data != NULL);
+    RX_ASSERT(fixture != NULL);
+    RX_ASSERT(context != NULL);
+
+    RXP_FIXTURES_LOCK();
+
+    snapshot = NULL;
+    for (i = 0; i < rxp_snapshots_instance.count; ++i) {
+        const struct rx_fixture *it;
+
+        it = &rxp_snapshots_instance.entries[i].fixture;
+        if (it->size == fixture->size
+            && it->config.set_up == fixture->config.set_up
+            && it->config.tear_down == fixture->config.tear_down) {
+            snapshot = &rxp_snapshots_instance.entries[i];
+            break;
+        }
+    }
+
+    if (snapshot == NULL) {
+        struct rxp_snapshot *entries;
+
+        entries = (struct rxp_snapshot *)RX_REALLOC(
+            rxp_snapshots_instance.entries,
+            sizeof *entries * (rxp_snapshots_instance.count + 1));
+        if (entries == NULL) {
+            RXP_LOG_ERROR("failed to allocate the snapshots\n");
+            RXP_FIXTURES_UNLOCK();
+            return RX_ERROR_ALLOCATION;
+        }
+
+        rxp_snapshots_instance.entries = entries;
+        snapshot = &entries[rxp_snapshots_instance.count];
+        snapshot->fixture = *fixture;
+        snapshot->status = RX_SUCCESS;
+
+        /* Honour the same memory options as the data of the test cases. */
+        status = rxp_data_block_allocate(
+            &snapshot->block, NULL, fixture->size, &fixture->config);
+        if (status != RX_SUCCESS) {
+            RXP_LOG_ERROR("failed to allocate the snapshot\n");
+            RXP_FIXTURES_UNLOCK();
+            return status;
+        }
+
+        ++rxp_snapshots_instance.count;
+
+        /* A failure is remembered to not set up the fixture over again. */
+        memset(snapshot->block.data, 0, fixture->size);
+        if (fixture->config.set_up != NULL) {
+            snapshot->status
+                = fixture->config.set_up(context, snapshot->block.data);
+        }
+    }
+
+    status = snapshot->status;
+    snapshot_data = snapshot->block.data;
+
+    RXP_FIXTURES_UNLOCK();
+
+    /* The entries might be reallocated by then, but not their data. */
+    if (status == RX_SUCCESS) {
+        memcpy(data, snapshot_data, fixture->size);
+    }
+
+    return status;
+}
+
+static void
+rxp_snapshots_destroy(struct rxp_snapshots *snapshots)
+{
+    size_t i;
+
+    RX_ASSERT(snapshots != NULL);
+
+    for (i = 0; i < snapshots->count; ++i) {
+        struct rxp_snapshot *snapshot;
+
+        snapshot = &snapshots->entries[i];
+        if (snapshot->status == RX_SUCCESS
+            && snapshot->fixture.config.tear_down != NULL) {
+            struct rx_test_case test_case;
+            struct rx_summary summary;
+            struct rx_context context;
+
+            /* Any failure reported by the tear-down is discarded. */
+            memset(&test_case, 0, sizeof test_case);
+            test_case.suite_name = "<snapshot>";
+            test_case.name = "<snapshot>";
+
+            if (rx_summary_initialize(&summary, &test_case) == RX_SUCCESS) {
+                memset(&context, 0, sizeof context);
+                context.summary = &summary;
+                snapshot->fixture.config.tear_down(&context,
+                                                   snapshot->block.data);
+                rx_summary_terminate(&summary);
+            }
+        }
+
+        rxp_data_block_free(&snapshot->block, NULL);
+    }
+
+    RX_FREE(snapshots->entries);
+    snapshots->entries = NULL;
+    snapshots->count = 0;
+}
+
+/* Implementation: Test Case Run                                   O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   A test case running within the runner's process cannot be interrupted
+   safely, so one that exceeds its timeout is only reported as timed out once
+   it returns. To prevent a test case from hanging the whole run, a watchdog
+   thread tracks a slot for each thread running test cases. Upon expiry, the
+   watchdog reports the test case at fault and terminates the process.
+   Isolating test cases, either with `--isolate` or `--jobs`, allows the run
+   to carry on by killing the child process instead.
+*/
+
+struct rxp_watchdog;
+struct rxp_watchdog_slot;
+
+#if RXP_HAS_FORK
+/* State of a child process running a test case in isolation. */
+struct rxp_isolation {
+    int fd;
+    const struct rx_context *context;
+};
+
+static struct rxp_isolation rxp_isolation_instance = {-1, NULL};
+#endif
+
+static void
+rxp_summary_reset(struct rx_summary *summary)
+{
+    size_t i;
+
+    RX_ASSERT(summary != NULL);
+    RX_ASSERT(summary->failures != NULL);
+
+    /* Keep the failure storage around for the next run. */
+    for (i = 0; i < summary->failure_count; ++i) {
+        const struct rx_failure *failure;
+
+        failure = &summary->failures[i];
+
+        RX_FREE((void *)(uintptr_t)failure->file);
+        RX_FREE((void *)(uintptr_t)failure->msg);
+        RX_FREE((void *)(uintptr_t)failure->diagnostic_msg);
+    }
+
+    rxp_test_failure_array_clear(summary->failures);
+    summary->skipped = 0;
+    summary->error = NULL;
+    summary->assessed_count = 0;
+    summary->failure_count = 0;
+    summary->elapsed = 0;
+    memset(&summary->benchmark, 0, sizeof summary->benchmark);
+}
+
+static void
+rxp_summary_report(const struct rx_summary *summary,
+                   const struct rxp_options *options)
+{
+    RX_ASSERT(summary != NULL);
+    RX_ASSERT(options != NULL);
+
+    /* Only report the failures when running the test cases repeatedly. */
+    if (rxp_options_get_pass_count(options) > 1
+        && summary->failure_count == 0) {
+        return;
+    }
+
+    rx_summary_print(summary);
+}
+
+static enum rx_status
+rxp_summary_add_failure(struct rx_summary *summary,
+                        const char *file,
+                        int line,
+                        enum rx_severity severity,
+                        const char *msg)
+{
+    struct rx_context context;
+
+    RX_ASSERT(summary != NULL);
+
+    context.summary = summary;
+    return rx_handle_test_result(
+        &context, RXP_FALSE, file, line, severity, msg, NULL);
+}
+
+static enum rx_status
+rxp_summary_add_timeout_failure(struct rx_summary *summary,
+                                rx_uint64 timeout_ms)
+{
+    enum rx_status status;
+    char *msg;
+
+    RX_ASSERT(summary != NULL);
+
+    RXP_STR_CREATE_1(status,
+                     msg,
+                     "the test case timed out (timeout: %lu ms)",
+                     (unsigned long)timeout_ms);
+    if (status != RX_SUCCESS) {
+        RXP_LOG_DEBUG("failed to create the timeout message\n");
+        msg = NULL;
+    }
+
+    status = rxp_summary_add_failure(summary, "<unknown>", 0, RX_FATAL, msg);
+    RX_FREE(msg);
+    return status;
+}
+
+static rx_uint64
+rxp_test_case_get_timeout(const struct rx_test_case *test_case,
+                          const struct rxp_options *options)
+{
+    RX_ASSERT(test_case != NULL);
+    RX_ASSERT(options != NULL);
+
+    return test_case->config.timeout_ms > 0 ? test_case->config.timeout_ms
+                                            : options->timeout_ms;
+}
+
+static int
+rxp_test_cases_have_timeouts(size_t test_case_count,
+                             const struct rx_test_case *test_cases,
+                             const struct rxp_options *options)
+{
+    size_t i;
+
+    RX_ASSERT(test_cases != NULL);
+    RX_ASSERT(options != NULL);
+
+    for (i = 0; i < test_case_count; ++i) {
+        if (rxp_test_case_get_timeout(&test_cases[i], options) > 0) {
+            return RXP_TRUE;
+        }
+    }
+
+    return RXP_FALSE;
+}
+
+static int
+rxp_test_case_uses_guard_pages(const struct rx_test_case *test_case)
+{
+    RX_ASSERT(test_case != NULL);
+
+    return test_case->config.fixture.config.guard_pages
+           && test_case->config.fixture.size > 0;
+}
+
+static int
+rxp_test_cases_have_guard_pages(size_t test_case_count,
+                                const struct rx_test_case *test_cases)
+{
+    size_t i;
+
+    RX_ASSERT(test_cases != NULL);
+
+    for (i = 0; i < test_case_count; ++i) {
+        if (rxp_test_case_uses_guard_pages(&test_cases[i])) {
+            return RXP_TRUE;
+        }
+    }
+
+    return RXP_FALSE;
+}
+
+#if RXP_HAS_THREADS
+struct rxp_watchdog_slot {
+    struct rxp_watchdog *watchdog;
+    const struct rx_test_case *test_case;
+    uint64_t deadline;
+    int armed;
+};
+
+struct rxp_watchdog {
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    struct rxp_watchdog_slot *slots;
+    size_t slot_count;
+    int quit;
+};
+
+static void
+rxp_watchdog_write(const char *str)
+{
+    size_t size;
+
+    /* Bypass the stdio streams since a hung test case might be holding
+       their locks. */
+    size = strlen(str);
+    while (size > 0) {
+        ssize_t written;
+
+        written = write(STDERR_FILENO, str, size);
+        if (written <= 0) {
+            return;
+        }
+
+        str += written;
+        size -= (size_t)written;
+    }
+}
+
+static void
+rxp_watchdog_terminate(const struct rx_test_case *test_case)
+{
+    rxp_watchdog_write("rexo: the test case \"");
+    rxp_watchdog_write(test_case->suite_name);
+    rxp_watchdog_write("\" / \"");
+    rxp_watchdog_write(test_case->name);
+    rxp_watchdog_write("\" timed out and cannot be interrupted on this "
+                       "platform, aborting the run\n");
+    _exit(EXIT_FAILURE);
+}
+
+static void *
+rxp_watchdog_run(void *arg)
+{
+    struct rxp_watchdog *watchdog;
+
+    watchdog = (struct rxp_watchdog *)arg;
+
+    pthread_mutex_lock(&watchdog->mutex);
+
+    while (!watchdog->quit) {
+        uint64_t now;
+        uint64_t next_deadline;
+        size_t i;
+
+        if (rxp_get_real_time(&now) != RX_SUCCESS) {
+            now = 0;
+        }
+
+        next_deadline = (uint64_t)-1;
+        for (i = 0; i < watchdog->slot_count; ++i) {
+            struct rxp_watchdog_slot *slot;
+
+            slot = &watchdog->slots[i];
+            if (!slot->armed) {
+                continue;
+            }
+
+            if (now >= slot->deadline) {
+                rxp_watchdog_terminate(slot->test_case);
+            } else if (slot->deadline < next_deadline) {
+                next_deadline = slot->deadline;
+            }
+        }
+
+        if (next_deadline == (uint64_t)-1) {
+            pthread_cond_wait(&watchdog->cond, &watchdog->mutex);
+        } else {
+            struct timespec time;
+            uint64_t remaining;
+
+            /* Condition variables wait on the real-time clock. */
+            remaining = next_deadline - now;
+            clock_gettime(CLOCK_REALTIME, &time);
+            remaining += (uint64_t)time.tv_nsec;
+            time.tv_sec += (time_t)(remaining / RXP_TICKS_PER_SECOND);
+            time.tv_nsec = (long)(remaining % RXP_TICKS_PER_SECOND);
+            pthread_cond_timedwait(&watchdog->cond, &watchdog->mutex, &time);
+        }
+    }
+
+    pthread_mutex_unlock(&watchdog->mutex);
+    return NULL;
+}
+
+static enum rx_status
+rxp_watchdog_start(struct rxp_watchdog *watchdog, size_t slot_count)
+{
+    size_t i;
+
+    RX_ASSERT(watchdog != NULL);
+    RX_ASSERT(slot_count > 0);
+
+    watchdog->slots = (struct rxp_watchdog_slot *)RX_MALLOC(
+        sizeof *watchdog->slots * slot_count);
+    if (watchdog->slots == NULL) {
+        RXP_LOG_ERROR("failed to allocate the watchdog\n");
+        return RX_ERROR_ALLOCATION;
+    }
+
+    memset(watchdog->slots, 0, sizeof *watchdog->slots * slot_count);
+    for (i = 0; i < slot_count; ++i) {
+        watchdog->slots[i].watchdog = watchdog;
+    }
+
+    watchdog->slot_count = slot_count;
+    watchdog->quit = 0;
+
+    pthread_mutex_init(&watchdog->mutex, NULL);
+    pthread_cond_init(&watchdog->cond, NULL);
+
+    if (pthread_create(&watchdog->thread, NULL, rxp_watchdog_run, watchdog)
+        != 0) {
+        RXP_LOG_ERROR("failed to create the watchdog thread\n");
+        pthread_cond_destroy(&watchdog->cond);
+        pthread_mutex_destroy(&watchdog->mutex);
+        RX_FREE(watchdog->slots);
+        return RX_ERROR;
+    }
+
+    return RX_SUCCESS;
+}
+
+static void
+rxp_watchdog_stop(struct rxp_watchdog *watchdog)
+{
+    RX_ASSERT(watchdog != NULL);
+
+    pthread_mutex_lock(&watchdog->mutex);
+    watchdog->quit = 1;
+    pthread_cond_signal(&watchdog->cond);
+    pthread_mutex_unlock(&watchdog->mutex);
+
+    pthread_join(watchdog->thread, NULL);
+
+    pthread_cond_destroy(&watchdog->cond);
+    pthread_mutex_destroy(&watchdog->mutex);
+    RX_FREE(watchdog->slots);
+}
+
+static void
+rxp_watchdog_slot_arm(struct rxp_watchdog_slot *slot,
+                      const struct rx_test_case *test_case,
+                      rx_uint64 timeout_ms)
+{
+    struct rxp_watchdog *watchdog;
+    uint64_t now;
+
+    RX_ASSERT(slot != NULL);
+    RX_ASSERT(test_case != NULL);
+
+    watchdog = slot->watchdog;
+    RX_ASSERT(watchdog != NULL);
+
+    if (rxp_get_real_time(&now) != RX_SUCCESS) {
+        now = 0;
+    }
+
+    pthread_mutex_lock(&watchdog->mutex);
+    slot->test_case = test_case;
+    slot->deadline = now + timeout_ms * (RXP_TICKS_PER_SECOND / 1000);
+    slot->armed = 1;
+    pthread_cond_signal(&watchdog->cond);
+    pthread_mutex_unlock(&watchdog->mutex);
+}
+
+static void
+rxp_watchdog_slot_disarm(struct rxp_watchdog_slot *slot)
+{
+    struct rxp_watchdog *watchdog;
+
+    RX_ASSERT(slot != NULL);
+
+    watchdog = slot->watchdog;
+    RX_ASSERT(watchdog != NULL);
+
+    pthread_mutex_lock(&watchdog->mutex);
+    slot->armed = 0;
+    pthread_mutex_unlock(&watchdog->mutex);
+}
+
+static struct rxp_watchdog_slot *
+rxp_watchdog_get_slot(struct rxp_watchdog *watchdog, size_t index)
+{
+    if (watchdog == NULL) {
+        return NULL;
+    }
+
+    RX_ASSERT(index < watchdog->slot_count);
+    return &watchdog->slots[index];
+}
+#else
+static struct rxp_watchdog_slot *
+rxp_watchdog_get_slot(struct rxp_watchdog *watchdog, size_t index)
+{
+    RXP_UNUSED(watchdog);
+    RXP_UNUSED(index);
+    return NULL;
+}
+#endif /* RXP_HAS_THREADS */
+
+static enum rx_status
+rxp_test_case_run(struct rx_summary *summary,
+                  const struct rx_test_case *test_case,
+                  struct rxp_watchdog_slot *slot,
+                  struct rxp_data_pool *data_pool,
+                  rx_uint64 timeout_ms)
+{
+    enum rx_status status;
+    struct rx_context context;
+    struct rxp_shared_fixture local_shared_fixture;
+    struct rxp_shared_fixture *shared_fixture;
+    struct rxp_data_block block;
+    struct rxp_benchmark benchmark;
+    void *data;
+    uint64_t time_begin;
+    uint64_t time_end;
+
+    RX_ASSERT(summary != NULL);
+    RX_ASSERT(test_case != NULL);
+    RX_ASSERT(test_case->suite_name != NULL);
+    RX_ASSERT(test_case->name != NULL);
+    RX_ASSERT(test_case->run != NULL);
+
+#if !RXP_HAS_THREADS
+    RXP_UNUSED(slot);
+    RXP_UNUSED(timeout_ms);
+#endif
+
+    if (rxp_test_case_is_skipped(test_case)) {
+        summary->skipped = 1;
+        return RX_SUCCESS;
+    }
+
+    status = RX_SUCCESS;
+    context.summary = summary;
+    context.file = NULL;
+    context.line = 0;
+    context.shared_data = NULL;
+    context.session_data = NULL;
+    context.param = test_case->param;
+    context.benchmark = &benchmark;
+    context.settings = &rxp_settings_instance;
+
+    rxp_benchmark_initialize(
+        &benchmark, test_case, &rxp_settings_instance, &summary->benchmark);
+
+#if RXP_HAS_FORK
+    if (rxp_isolation_instance.fd >= 0) {
+        rxp_isolation_instance.context = &context;
+    }
+#endif
+
+    if (test_case->config.session_fixture != NULL) {
+        status = rxp_session_fixture_acquire(&context.session_data,
+                                             test_case->config.session_fixture,
+                                             &context);
+        if (status != RX_SUCCESS) {
+            summary->error = "failed to set-up the session fixture\0";
+            return status;
+        }
+    }
+
+    shared_fixture = NULL;
+    if (rxp_fixture_is_set(&test_case->config.shared_fixture)) {
+        shared_fixture = rxp_shared_fixtures_find(
+            &rxp_shared_fixtures_instance, test_case);
+
+        /* Test cases run on their own get their own instance. */
+        if (shared_fixture == NULL) {
+            rxp_shared_fixture_initialize(&local_shared_fixture, test_case);
+            local_shared_fixture.total = 1;
+            local_shared_fixture.remaining = 1;
+            shared_fixture = &local_shared_fixture;
+        }
+
+        status = rxp_shared_fixture_acquire(
+            &context.shared_data, shared_fixture, &context);
+        if (status != RX_SUCCESS) {
+            summary->error = "failed to set-up the shared fixture\0";
+            goto shared_fixture_cleanup;
+        }
+    }
+
+    status = rxp_data_block_allocate(&block,
+                                     data_pool,
+                                     test_case->config.fixture.size,
+                                     &test_case->config.fixture.config);
+    if (status != RX_SUCCESS) {
+        summary->error = "failed to allocate the data\0";
+        RXP_LOG_ERROR_2("failed to allocate the data"
+                        "(suite: \"%s\", case: \"%s\")\n",
+                        test_case->suite_name,
+                        test_case->name);
+        goto shared_fixture_cleanup;
+    }
+
+    data = block.data;
+
+    if (rxp_fixture_uses_snapshot(&test_case->config.fixture)) {
+        status = rxp_snapshot_restore(
+            data, &test_case->config.fixture, &context);
+        if (status != RX_SUCCESS) {
+            summary->error = "failed to set-up the fixture\0";
+            RXP_LOG_ERROR_2("failed to set-up the fixture snapshot "
+                            "(suite: \"%s\", case: \"%s\")\n",
+                            test_case->suite_name,
+                            test_case->name);
+            goto data_cleanup;
+        }
+    } else if (test_case->config.fixture.config.set_up != NULL) {
+        status = test_case->config.fixture.config.set_up(&context, data);
+        if (status != RX_SUCCESS) {
+            summary->error = "failed to set-up the fixture\0";
+            RXP_LOG_ERROR_2("failed to set-up the fixture "
+                            "(suite: \"%s\", case: \"%s\")\n",
+                            test_case->suite_name,
+                            test_case->name);
+            goto data_cleanup;
+        }
+    }
+
+    if (rxp_get_real_time(&time_begin) != RX_SUCCESS) {
+        time_begin = (uint64_t)-1;
+    }
+
+#if RXP_HAS_THREADS
+    if (slot != NULL && timeout_ms > 0) {
+        rxp_watchdog_slot_arm(slot, test_case, timeout_ms);
+    }
+#endif
+
+    if (setjmp(context.env) == 0) {
+        test_case->run(&context, data);
+    }
+
+#if RXP_HAS_THREADS
+    if (slot != NULL && timeout_ms > 0) {
+        rxp_watchdog_slot_disarm(slot);
+    }
+#endif
+
+    rxp_benchmark_terminate(&benchmark);
+
+    if (time_begin == (uint64_t)-1
+        || rxp_get_real_time(&time_end) != RX_SUCCESS) {
+        RXP_LOG_ERROR_2("failed to measure the time elapsed "
+                        "(suite: \"%s\", case: \"%s\")\n",
+                        test_case->suite_name,
+                        test_case->name);
+        summary->elapsed = 0;
+    } else {
+        RX_ASSERT(time_end >= time_begin);
+        summary->elapsed = (rx_uint64)(time_end - time_begin);
+    }
+
+    if (timeout_ms > 0
+        && summary->elapsed > timeout_ms * (RXP_TICKS_PER_SECOND / 1000)) {
+        status = rxp_summary_add_timeout_failure(summary, timeout_ms);
+        if (status != RX_SUCCESS) {
+            goto data_cleanup;
+        }
+    }
+
+    if (test_case->config.fixture.config.tear_down != NULL
+        && !rxp_fixture_uses_snapshot(&test_case->config.fixture)) {
+        test_case->config.fixture.config.tear_down(&context, data);
+    }
+
+data_cleanup:
+    rxp_data_block_free(&block, data_pool);
+
+shared_fixture_cleanup:
+    if (shared_fixture != NULL) {
+        rxp_shared_fixture_release(shared_fixture, &context);
+    }
+
+    return status;
+}
+
+/* Implementation: Inter-Process Communication                     O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   Child processes forked from the runner are not re-executed, meaning that
+   they share the same memory layout as the runner. Test cases can thus be
+   referred to through their index, and pointers to static data such as
+   string literals remain valid when sent back to the runner.
+
+   Summaries are serialized with a prefix indicating their size in bytes.
+*/
+
+#if RXP_HAS_FORK
+struct rxp_buffer {
+    char *data;
+    size_t size;
+    size_t capacity;
+};
+
+struct rxp_reader {
+    const char *it;
+    const char *end;
+};
+
+static enum rx_status
+rxp_fd_write(int fd, const void *buf, size_t size)
+{
+    const char *it;
+
+    it = (const char *)buf;
+    while (size > 0) {
+        ssize_t count;
+
+        count = write(fd, it, size);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            RXP_LOG_DEBUG("failed to write to a file descriptor\n");
+            return RX_ERROR;
+        }
+
+        it += count;
+        size -= (size_t)count;
+    }
+
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_fd_read(int fd, void *buf, size_t size)
+{
+    char *it;
+
+    it = (char *)buf;
+    while (size > 0) {
+        ssize_t count;
+
+        count = read(fd, it, size);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            RXP_LOG_DEBUG("failed to read from a file descriptor\n");
+            return RX_ERROR;
+        }
+
+        if (count == 0) {
+            /* End of file reached before reading the requested size. */
+            return RX_ERROR;
+        }
+
+        it += count;
+        size -= (size_t)count;
+    }
+
+    return RX_SUCCESS;
+}
+
+static void
+rxp_fd_close(int *fd)
+{
+    RX_ASSERT(fd != NULL);
+
+    if (*fd >= 0) {
+        close(*fd);
+        *fd = -1;
+    }
+}
+
+static enum rx_status
+rxp_buffer_append(struct rxp_buffer *buffer, const void *data, size_t size)
+{
+    RX_ASSERT(buffer != NULL);
+
+    if (buffer->size + size > buffer->capacity) {
+        size_t capacity;
+        char *block;
+
+        rxp_dyn_array_get_new_capacity(
+            &capacity, buffer->capacity, buffer->size + size, (size_t)-1);
+
+        block = (char *)RX_REALLOC(buffer->data, capacity);
+        if (block == NULL) {
+            RXP_LOG_DEBUG_1("failed to grow the buffer (%lu bytes)\n",
+                            (unsigned long)capacity);
+            return RX_ERROR_ALLOCATION;
+        }
+
+        buffer->data = block;
+        buffer->capacity = capacity;
+    }
+
+    memcpy(&buffer->data[buffer->size], data, size);
+    buffer->size += size;
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_buffer_append_str(struct rxp_buffer *buffer, const char *s)
+{
+    enum rx_status status;
+    rx_size length;
+
+    /* A length set to the maximum value denotes a `NULL` string. */
+    length = s == NULL ? (rx_size)-1 : (rx_size)strlen(s);
+
+    status = rxp_buffer_append(buffer, &length, sizeof length);
+    if (status != RX_SUCCESS || s == NULL) {
+        return status;
+    }
+
+    return rxp_buffer_append(buffer, s, (size_t)length);
+}
+
+static enum rx_status
+rxp_reader_read(struct rxp_reader *reader, void *data, size_t size)
+{
+    RX_ASSERT(reader != NULL);
+
+    if ((size_t)(reader->end - reader->it) < size) {
+        RXP_LOG_DEBUG("unexpected end of the serialized data\n");
+        return RX_ERROR;
+    }
+
+    memcpy(data, reader->it, size);
+    reader->it += size;
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_reader_read_str(struct rxp_reader *reader, const char **s)
+{
+    enum rx_status status;
+    rx_size length;
+    char *buf;
+
+    RX_ASSERT(s != NULL);
+
+    *s = NULL;
+
+    status = rxp_reader_read(reader, &length, sizeof length);
+    if (status != RX_SUCCESS || length == (rx_size)-1) {
+        return status;
+    }
+
+    if ((size_t)(reader->end - reader->it) < (size_t)length) {
+        RXP_LOG_DEBUG("unexpected end of the serialized data\n");
+        return RX_ERROR;
+    }
+
+    buf = (char *)RX_MALLOC(sizeof *buf * ((size_t)length + 1));
+    if (buf == NULL) {
+        RXP_LOG_DEBUG_1("failed to allocate the string (%lu bytes)\n",
+                        (unsigned long)sizeof *buf * ((size_t)length + 1));
+        return RX_ERROR_ALLOCATION;
+    }
+
+    memcpy(buf, reader->it, (size_t)length);
+    buf[length] = '\0';
+    reader->it += length;
+    *s = buf;
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_summary_serialize(struct rxp_buffer *buffer,
+                      size_t index,
+                      enum rx_status test_status,
+                      const struct rx_summary *summary)
+{
+    enum rx_status status;
+    rx_size value;
+    int flag;
+    size_t i;
+
+    RX_ASSERT(buffer != NULL);
+    RX_ASSERT(summary != NULL);
+
+    buffer->size = 0;
+
+    /* Reserve some space for the size of the payload. */
+    value = 0;
+    status = rxp_buffer_append(buffer, &value, sizeof value);
+    if (status != RX_SUCCESS) {
+        return status;
+    }
+
+    value = (rx_size)index;
+    flag = (int)test_status;
+    if ((status = rxp_buffer_append(buffer, &value, sizeof value))
+            != RX_SUCCESS
+        || (status = rxp_buffer_append(buffer, &flag, sizeof flag))
+               != RX_SUCCESS
+        || (status = rxp_buffer_append(
+                buffer, &summary->skipped, sizeof summary->skipped))
+               != RX_SUCCESS
+        || (status = rxp_buffer_append(
+                buffer, &summary->error, sizeof summary->error))
+               != RX_SUCCESS
+        || (status = rxp_buffer_append(buffer,
+                                       &summary->assessed_count,
+                                       sizeof summary->assessed_count))
+               != RX_SUCCESS
+        || (status = rxp_buffer_append(buffer,
+                                       &summary->failure_count,
+                                       sizeof summary->failure_count))
+               != RX_SUCCESS
+        || (status = rxp_buffer_append(
+                buffer, &summary->elapsed, sizeof summary->elapsed))
+               != RX_SUCCESS
+        || (status = rxp_buffer_append(
+                buffer, &summary->benchmark, sizeof summary->benchmark))
+               != RX_SUCCESS) {
+        return status;
+    }
+
+    for (i = 0; i < summary->failure_count; ++i) {
+        const struct rx_failure *failure;
+
+        failure = &summary->failures[i];
+        flag = (int)failure->severity;
+        if ((status = rxp_buffer_append(
+                 buffer, &failure->line, sizeof failure->line))
+                != RX_SUCCESS
+            || (status = rxp_buffer_append(buffer, &flag, sizeof flag))
+                   != RX_SUCCESS
+            || (status = rxp_buffer_append_str(buffer, failure->file))
+                   != RX_SUCCESS
+            || (status = rxp_buffer_append_str(buffer, failure->msg))
+                   != RX_SUCCESS
+            || (status
+                = rxp_buffer_append_str(buffer, failure->diagnostic_msg))
+                   != RX_SUCCESS) {
+            return status;
+        }
+    }
+
+    value = (rx_size)(buffer->size - sizeof value);
+    memcpy(buffer->data, &value, sizeof value);
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_summary_deserialize(size_t *index,
+                        enum rx_status *test_status,
+                        struct rx_summary *summaries,
+                        size_t summary_count,
+                        struct rxp_reader *reader)
+{
+    enum rx_status status;
+    struct rx_summary *summary;
+    rx_size value;
+    rx_size failure_count;
+    int flag;
+    size_t i;
+
+    RX_ASSERT(index != NULL);
+    RX_ASSERT(test_status != NULL);
+    RX_ASSERT(summaries != NULL);
+    RX_ASSERT(reader != NULL);
+
+    status = rxp_reader_read(reader, &value, sizeof value);
+    if (status != RX_SUCCESS) {
+        return status;
+    }
+
+    if ((size_t)value >= summary_count) {
+        RXP_LOG_DEBUG("invalid test case index\n");
+        return RX_ERROR;
+    }
+
+    *index = (size_t)value;
+    summary = &summaries[*index];
+
+    if ((status = rxp_reader_read(reader, &flag, sizeof flag)) != RX_SUCCESS
+        || (status = rxp_reader_read(
+                reader, &summary->skipped, sizeof summary->skipped))
+               != RX_SUCCESS
+        || (status = rxp_reader_read(
+                reader, &summary->error, sizeof summary->error))
+               != RX_SUCCESS
+        || (status = rxp_reader_read(reader,
+                                     &summary->assessed_count,
+                                     sizeof summary->assessed_count))
+               != RX_SUCCESS
+        || (status = rxp_reader_read(
+                reader, &failure_count, sizeof failure_count))
+               != RX_SUCCESS
+        || (status = rxp_reader_read(
+                reader, &summary->elapsed, sizeof summary->elapsed))
+               != RX_SUCCESS
+        || (status = rxp_reader_read(
+                reader, &summary->benchmark, sizeof summary->benchmark))
+               != RX_SUCCESS) {
+        return status;
+    }
+
+    *test_status = (enum rx_status)flag;
+
+    for (i = 0; i < failure_count; ++i) {
+        struct rx_failure *failure;
+        size_t size;
+
+        status = rxp_test_failure_array_extend_back(
+            &failure, &summary->failures, 1);
+        if (status != RX_SUCCESS) {
+            return status;
+        }
+
+        memset(failure, 0, sizeof *failure);
+        rxp_test_failure_array_get_size(&size, summary->failures);
+        summary->failure_count = size;
+
+        if ((status = rxp_reader_read(
+                 reader, &failure->line, sizeof failure->line))
+                != RX_SUCCESS
+            || (status = rxp_reader_read(reader, &flag, sizeof flag))
+                   != RX_SUCCESS
+            || (status = rxp_reader_read_str(reader, &failure->file))
+                   != RX_SUCCESS
+            || (status = rxp_reader_read_str(reader, &failure->msg))
+                   != RX_SUCCESS
+            || (status
+                = rxp_reader_read_str(reader, &failure->diagnostic_msg))
+                   != RX_SUCCESS) {
+            return status;
+        }
+
+        failure->severity = (enum rx_severity)flag;
+    }
+
+    return RX_SUCCESS;
+}
+
+static void
+rxp_signal_get_name(const char **name, int signal_number)
+{
+    RX_ASSERT(name != NULL);
+
+    switch (signal_number) {
+        case SIGABRT:
+            *name = "SIGABRT";
+            return;
+        case SIGFPE:
+            *name = "SIGFPE";
+            return;
+        case SIGILL:
+            *name = "SIGILL";
+            return;
+        case SIGINT:
+            *name = "SIGINT";
+            return;
+        case SIGKILL:
+            *name = "SIGKILL";
+            return;
+        case SIGPIPE:
+            *name = "SIGPIPE";
+            return;
+        case SIGSEGV:
+            *name = "SIGSEGV";
+            return;
+        case SIGTERM:
+            *name = "SIGTERM";
+            return;
+#if defined(SIGBUS)
+        case SIGBUS:
+            *name = "SIGBUS";
+            return;
+#endif
+        default:
+            *name = "unknown signal";
+            return;
+    }
+}
+
+static enum rx_status
+rxp_summary_add_termination_failure(struct rx_summary *summary,
+                                    int exit_status,
+                                    const char *file,
+                                    int line)
+{
+    enum rx_status status;
+    char *msg;
+
+    RX_ASSERT(summary != NULL);
+
+    if (WIFSIGNALED(exit_status)) {
+        const char *signal_name;
+
+        rxp_signal_get_name(&signal_name, WTERMSIG(exit_status));
+        RXP_STR_CREATE_2(status,
+                         msg,
+                         "the test case crashed (signal %d: %s)",
+                         WTERMSIG(exit_status),
+                         signal_name);
+    } else {
+        RXP_STR_CREATE_1(status,
+                         msg,
+                         "the test case exited prematurely (exit code: %d)",
+                         WIFEXITED(exit_status) ? WEXITSTATUS(exit_status)
+                                                : -1);
+    }
+
+    if (status != RX_SUCCESS) {
+        RXP_LOG_DEBUG("failed to create the termination message\n");
+        msg = NULL;
+    }
+
+    if (file == NULL) {
+        file = "<unknown>";
+        line = 0;
+    }
+
+    status = rxp_summary_add_failure(summary, file, line, RX_FATAL, msg);
+    RX_FREE(msg);
+    return status;
+}
+
+#endif /* RXP_HAS_FORK */
+
+/* Implementation: Isolation                                       O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   In isolation mode, test cases run in child processes forked from the
+   runner, right before setting up their fixture, meaning that the fixture's
+   set-up, the test case, and the fixture's tear-down keep running in that
+   order, but within the child. Cheaper alternatives such as `vfork()` or
+   `posix_spawn()` aren't an option since they require executing a new
+   program image, while the child needs to share the runner's memory to run
+   the test case.
+
+   The runner acts as a fork server: it only forks children once the test
+   cases are discovered and ready to run, and each child can run a batch of
+   consecutive test cases to amortize the cost of forking.
+
+   The child sends back the summary of each test case as soon as it completes,
+   serialized the same way as for the worker processes. If it crashes instead,
+   its signal handler first reports the location of the last test assessed,
+   as a message with a size of zero. The runner then resumes the batch with
+   a new child, starting after the test case that crashed.
+*/
+
+#if RXP_HAS_FORK
+struct rxp_isolation_batch {
+    struct rx_summary *summaries;
+    const struct rx_test_case *test_cases;
+    size_t count;
+    size_t received;
+    enum rx_status test_status;
+    const char *crash_file;
+    int crash_line;
+    uint64_t started;
+};
+
+static const int rxp_isolation_crash_signals[] = {
+    SIGABRT,
+    SIGFPE,
+    SIGILL,
+    SIGSEGV,
+#if defined(SIGBUS)
+    SIGBUS,
+#endif
+};
+
+static void
+rxp_isolation_handle_crash(int signal_number)
+{
+    struct sigaction action;
+    const struct rx_context *context;
+
+    context = rxp_isolation_instance.context;
+    if (rxp_isolation_instance.fd >= 0 && context != NULL
+        && context->file != NULL) {
+        char msg[sizeof(rx_size) + sizeof context->file
+                 + sizeof context->line];
+        rx_size size;
+        ssize_t written;
+
+        /* Only async-signal-safe calls from here on. */
+        size = 0;
+        memcpy(&msg[0], &size, sizeof size);
+        memcpy(&msg[sizeof size], &context->file, sizeof context->file);
+        memcpy(&msg[sizeof size + sizeof context->file],
+               &context->line,
+               sizeof context->line);
+        written = write(rxp_isolation_instance.fd, msg, sizeof msg);
+        RXP_UNUSED(written);
+    }
+
+    memset(&action, 0, sizeof action);
+    action.sa_handler = SIG_DFL;
+    sigemptyset(&action.sa_mask);
+    sigaction(signal_number, &action, NULL);
+    raise(signal_number);
+}
+
+static int
+rxp_isolation_child_run(int result_fd,
+                        struct rx_summary *summaries,
+                        size_t test_case_count,
+                        const struct rx_test_case *test_cases)
+{
+    int out;
+    struct sigaction action;
+    struct rxp_buffer buffer;
+    struct rxp_data_pool data_pool;
+    size_t i;
+
+    rxp_isolation_instance.fd = result_fd;
+
+    memset(&action, 0, sizeof action);
+    action.sa_handler = rxp_isolation_handle_crash;
+    sigemptyset(&action.sa_mask);
+    for (i = 0; i < sizeof rxp_isolation_crash_signals
+                        / sizeof rxp_isolation_crash_signals[0];
+         ++i) {
+        sigaction(rxp_isolation_crash_signals[i], &action, NULL);
+    }
+
+    out = 0;
+    memset(&buffer, 0, sizeof buffer);
+    rxp_data_pool_initialize(&data_pool);
+
+    for (i = 0; i < test_case_count; ++i) {
+        enum rx_status status;
+
+        rxp_isolation_instance.context = NULL;
+        status = rxp_test_case_run(
+            &summaries[i], &test_cases[i], NULL, &data_pool, 0);
+
+        if (rxp_summary_serialize(&buffer, i, status, &summaries[i])
+                != RX_SUCCESS
+            || rxp_fd_write(result_fd, buffer.data, buffer.size)
+                   != RX_SUCCESS) {
+            out = 1;
+            break;
+        }
+    }
+
+    rxp_shared_fixtures_tear_down(&rxp_shared_fixtures_instance);
+    rxp_session_fixtures_tear_down(test_case_count, test_cases);
+    rxp_snapshots_destroy(&rxp_snapshots_instance);
+    rxp_data_pool_terminate(&data_pool);
+    RX_FREE(buffer.data);
+    return out;
+}
+
+static enum rx_status
+rxp_isolation_batch_parse(struct rxp_isolation_batch *batch,
+                          struct rxp_reader *reader)
+{
+    enum rx_status status;
+
+    RX_ASSERT(batch != NULL);
+    RX_ASSERT(reader != NULL);
+
+    /* Only consume the messages that are complete. */
+    for (;;) {
+        struct rxp_reader message;
+        rx_size size;
+
+        if ((size_t)(reader->end - reader->it) < sizeof size) {
+            return RX_SUCCESS;
+        }
+
+        message = *reader;
+        status = rxp_reader_read(&message, &size, sizeof size);
+        RX_ASSERT(status == RX_SUCCESS);
+
+        if (size == 0) {
+            if ((size_t)(message.end - message.it)
+                < sizeof batch->crash_file + sizeof batch->crash_line) {
+                return RX_SUCCESS;
+            }
+
+            status = rxp_reader_read(
+                &message, &batch->crash_file, sizeof batch->crash_file);
+            RX_ASSERT(status == RX_SUCCESS);
+            status = rxp_reader_read(
+                &message, &batch->crash_line, sizeof batch->crash_line);
+            RX_ASSERT(status == RX_SUCCESS);
+        } else {
+            size_t index;
+
+            if ((size_t)(message.end - message.it) < (size_t)size) {
+                return RX_SUCCESS;
+            }
+
+            message.end = message.it + size;
+            status = rxp_summary_deserialize(&index,
+                                             &batch->test_status,
+                                             batch->summaries,
+                                             batch->count,
+                                             &message);
+            if (status != RX_SUCCESS) {
+                return status;
+            }
+
+            if (index != batch->received) {
+                RXP_LOG_DEBUG("unexpected result from an isolated test "
+                              "case\n");
+                return RX_ERROR;
+            }
+
+            ++batch->received;
+            if (rxp_get_real_time(&batch->started) != RX_SUCCESS) {
+                batch->started = 0;
+            }
+
+            if (batch->test_status != RX_SUCCESS) {
+                return RX_SUCCESS;
+            }
+        }
+
+        reader->it = message.end;
+    }
+}
+
+static enum rx_status
+rxp_isolation_batch_receive(int *timed_out,
+                            struct rxp_isolation_batch *batch,
+                            int fd,
+                            const struct rxp_options *options)
+{
+    enum rx_status status;
+    struct rxp_buffer buffer;
+    size_t offset;
+
+    RX_ASSERT(timed_out != NULL);
+    RX_ASSERT(batch != NULL);
+    RX_ASSERT(options != NULL);
+
+    *timed_out = RXP_FALSE;
+
+    status = RX_SUCCESS;
+    memset(&buffer, 0, sizeof buffer);
+    offset = 0;
+
+    while (batch->received < batch->count
+           && batch->test_status == RX_SUCCESS) {
+        struct pollfd poll_fd;
+        struct rxp_reader reader;
+        char chunk[4096];
+        ssize_t size;
+        rx_uint64 timeout_ms;
+        int poll_timeout;
+
+        /* The test case in progress is timed out from the last result. */
+        timeout_ms = rxp_test_case_get_timeout(
+            &batch->test_cases[batch->received], options);
+
+        poll_timeout = -1;
+        if (timeout_ms > 0) {
+            uint64_t deadline;
+            uint64_t now;
+            uint64_t remaining;
+
+            deadline = batch->started
+                       + timeout_ms * (RXP_TICKS_PER_SECOND / 1000);
+            if (rxp_get_real_time(&now) != RX_SUCCESS) {
+                now = 0;
+            }
+
+            if (now >= deadline) {
+                *timed_out = RXP_TRUE;
+                break;
+            }
+
+            remaining = (deadline - now + RXP_TICKS_PER_SECOND / 1000 - 1)
+                        / (RXP_TICKS_PER_SECOND / 1000);
+            poll_timeout = remaining > (uint64_t)INT_MAX ? INT_MAX
+                                                         : (int)remaining;
+        }
+
+        poll_fd.fd = fd;
+        poll_fd.events = POLLIN;
+        poll_fd.revents = 0;
+        if (poll(&poll_fd, 1, poll_timeout) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            RXP_LOG_ERROR("failed to wait for an isolated test case\n");
+            status = RX_ERROR;
+            break;
+        }
+
+        if (poll_fd.revents == 0) {
+            continue;
+        }
+
+        size = read(fd, chunk, sizeof chunk);
+        if (size < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            RXP_LOG_ERROR("failed to read the result of an isolated test "
+                          "case\n");
+            status = RX_ERROR;
+            break;
+        }
+
+        /* The child closes its end of the pipe when it terminates. */
+        if (size == 0) {
+            break;
+        }
+
+        status = rxp_buffer_append(&buffer, chunk, (size_t)size);
+        if (status != RX_SUCCESS) {
+            RXP_LOG_ERROR("failed to allocate the result of an isolated test "
+                          "case\n");
+            break;
+        }
+
+        reader.it = buffer.data + offset;
+        reader.end = buffer.data + buffer.size;
+        status = rxp_isolation_batch_parse(batch, &reader);
+        if (status != RX_SUCCESS) {
+            RXP_LOG_ERROR("failed to deserialize the result of an isolated "
+                          "test case\n");
+            break;
+        }
+
+        offset = (size_t)(reader.it - buffer.data);
+    }
+
+    RX_FREE(buffer.data);
+    return status;
+}
+
+static enum rx_status
+rxp_test_cases_run_isolated(size_t *done,
+                            struct rx_summary *summaries,
+                            size_t test_case_count,
+                            const struct rx_test_case *test_cases,
+                            const struct rxp_options *options)
+{
+    enum rx_status status;
+    struct rxp_isolation_batch batch;
+    struct rx_summary *summary;
+    int timed_out;
+    int exit_status;
+    int fds[2];
+    uint64_t now;
+    pid_t pid;
+
+    RX_ASSERT(done != NULL);
+    RX_ASSERT(summaries != NULL);
+    RX_ASSERT(test_case_count > 0);
+    RX_ASSERT(test_cases != NULL);
+    RX_ASSERT(options != NULL);
+
+    *done = 0;
+
+    if (rxp_test_case_is_skipped(&test_cases[0])) {
+        summaries[0].skipped = 1;
+        *done = 1;
+        return RX_SUCCESS;
+    }
+
+    if (pipe(fds) != 0) {
+        RXP_LOG_ERROR("failed to create the pipe of an isolated test case\n");
+        return RX_ERROR;
+    }
+
+    /* Prevent any pending output from being written once more by the child. */
+    fflush(stdout);
+    fflush(stderr);
+
+    memset(&batch, 0, sizeof batch);
+    batch.summaries = summaries;
+    batch.test_cases = test_cases;
+    batch.count = test_case_count;
+    batch.test_status = RX_SUCCESS;
+    if (rxp_get_real_time(&batch.started) != RX_SUCCESS) {
+        batch.started = 0;
+    }
+
+    pid = fork();
+    if (pid < 0) {
+        RXP_LOG_ERROR("failed to fork an isolated test case\n");
+        close(fds[0]);
+        close(fds[1]);
+        return RX_ERROR;
+    }
+
+    if (pid == 0) {
+        close(fds[0]);
+        _exit(rxp_isolation_child_run(
+            fds[1], summaries, test_case_count, test_cases));
+    }
+
+    close(fds[1]);
+
+    status = rxp_isolation_batch_receive(&timed_out, &batch, fds[0], options);
+    if (status != RX_SUCCESS || timed_out
+        || batch.test_status != RX_SUCCESS) {
+        kill(pid, SIGKILL);
+    }
+
+    close(fds[0]);
+
+    while (waitpid(pid, &exit_status, 0) < 0) {
+        if (errno != EINTR) {
+            RXP_LOG_DEBUG("failed to wait for an isolated test case\n");
+            exit_status = 0;
+            break;
+        }
+    }
+
+    *done = batch.received;
+
+    if (status != RX_SUCCESS) {
+        return status;
+    }
+
+    if (batch.test_status != RX_SUCCESS) {
+        /* Point at the test case that failed to run. */
+        --*done;
+        return batch.test_status;
+    }
+
+    if (batch.received == test_case_count) {
+        return RX_SUCCESS;
+    }
+
+    /* The test case in progress didn't complete. */
+    summary = &summaries[batch.received];
+    ++*done;
+
+    if (rxp_get_real_time(&now) != RX_SUCCESS) {
+        now = batch.started;
+    }
+
+    summary->elapsed = (rx_uint64)(now - batch.started);
+
+    if (timed_out) {
+        return rxp_summary_add_timeout_failure(
+            summary,
+            rxp_test_case_get_timeout(&test_cases[batch.received], options));
+    }
+
+    return rxp_summary_add_termination_failure(
+        summary, exit_status, batch.crash_file, batch.crash_line);
+}
+#endif /* RXP_HAS_FORK */
+
+static int
+rxp_test_case_needs_process(const struct rx_test_case *test_case,
+                            const struct rxp_options *options)
+{
+    RX_ASSERT(test_case != NULL);
+    RX_ASSERT(options != NULL);
+
+#if RXP_HAS_FORK
+    /* Worker processes already contain crashes and get killed on timeouts.
+       Otherwise, a test case running past its timeout can only be stopped by
+       killing its process, and a fault on a guard page would take the whole
+       run down. Test cases with a timeout are run by the main thread, when
+       the worker threads are idle, but the ones using guard pages aren't,
+       since forking while the worker threads run isn't safe. */
+    if (options->isolation_batch_size > 0) {
+        return RXP_TRUE;
+    }
+
+    if (options->job_count > 1) {
+        return RXP_FALSE;
+    }
+
+    return rxp_test_case_get_timeout(test_case, options) > 0
+           || (rxp_test_case_uses_guard_pages(test_case)
+               && options->thread_count <= 1);
+#else
+    RXP_UNUSED(test_case);
+    RXP_UNUSED(options);
+    return RXP_FALSE;
+#endif
+}
+
+static enum rx_status
+rxp_test_case_execute(struct rx_summary *summary,
+                      const struct rx_test_case *test_case,
+                      struct rxp_watchdog_slot *slot,
+                      struct rxp_data_pool *data_pool,
+                      const struct rxp_options *options)
+{
+    RX_ASSERT(options != NULL);
+
+#if RXP_HAS_FORK
+    if (rxp_test_case_needs_process(test_case, options)) {
+        size_t done;
+
+        return rxp_test_cases_run_isolated(
+            &done, summary, 1, test_case, options);
+    }
+#endif
+
+    return rxp_test_case_run(summary,
+                             test_case,
+                             slot,
+                             data_pool,
+                             rxp_test_case_get_timeout(test_case, options));
+}
+
+/* Implementation: Worker Processes                                O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   Test cases can be dispatched to a pool of worker processes forked from
+   the runner. The runner sends the index of a test case to run through a task
+   pipe, and the worker replies through a result pipe with the serialized
+   summary.
+*/
+
+#if RXP_HAS_FORK
+#define RXP_WORKER_PROCESS_IDLE ((size_t)-1)
+
+struct rxp_worker_process {
+    pid_t pid;
+    int task_fd;
+    int result_fd;
+    size_t task;
+    uint64_t started;
+    uint64_t deadline;
+};
+
+static int
+rxp_worker_process_run(int task_fd,
+                       int result_fd,
+                       size_t test_case_count,
+                       const struct rx_test_case *test_cases,
+                       const struct rxp_options *options)
+{
+    int out;
+    struct rxp_buffer buffer;
+    struct rxp_data_pool data_pool;
+
+    RX_ASSERT(test_cases != NULL);
+
+    out = 0;
+    memset(&buffer, 0, sizeof buffer);
+    rxp_data_pool_initialize(&data_pool);
+
+    for (;;) {
+        rx_size index;
+        enum rx_status status;
+        struct rx_summary summary;
+
+        /* The runner closes the task pipe once there's nothing left to do. */
+        if (rxp_fd_read(task_fd, &index, sizeof index) != RX_SUCCESS) {
+            break;
+        }
+
+        RX_ASSERT((size_t)index < test_case_count);
+
+        status = rx_summary_initialize(&summary, &test_cases[index]);
+        if (status != RX_SUCCESS) {
+            out = 1;
+            break;
+        }
+
+        /*
+           Timeouts are enforced by the runner, by killing the worker, unless
+           the test case runs in isolation, in which case the worker kills
+           its own child process instead.
+        */
+        status = rxp_test_case_execute(
+            &summary, &test_cases[index], NULL, &data_pool, options);
+
+        if (rxp_summary_serialize(&buffer, (size_t)index, status, &summary)
+                != RX_SUCCESS
+            || rxp_fd_write(result_fd, buffer.data, buffer.size)
+                   != RX_SUCCESS) {
+            rx_summary_terminate(&summary);
+            out = 1;
+            break;
+        }
+
+        rx_summary_terminate(&summary);
+    }
+
+    rxp_shared_fixtures_tear_down(&rxp_shared_fixtures_instance);
+    rxp_session_fixtures_tear_down(test_case_count, test_cases);
+    rxp_snapshots_destroy(&rxp_snapshots_instance);
+    rxp_data_pool_terminate(&data_pool);
+    RX_FREE(buffer.data);
+    return out;
+}
+
+static enum rx_status
+rxp_worker_process_spawn(struct rxp_worker_process *workers,
+                         size_t worker_count,
+                         size_t worker_index,
+                         size_t test_case_count,
+                         const struct rx_test_case *test_cases,
+                         const struct rxp_options *options)
+{
+    struct rxp_worker_process *worker;
+    int task_fds[2];
+    int result_fds[2];
+    pid_t pid;
+
+    RX_ASSERT(workers != NULL);
+    RX_ASSERT(worker_index < worker_count);
+
+    worker = &workers[worker_index];
+
+    if (pipe(task_fds) != 0) {
+        RXP_LOG_ERROR("failed to create the task pipe of a worker process\n");
+        return RX_ERROR;
+    }
+
+    if (pipe(result_fds) != 0) {
+        RXP_LOG_ERROR("failed to create the result pipe of a worker "
+                      "process\n");
+        close(task_fds[0]);
+        close(task_fds[1]);
+        return RX_ERROR;
+    }
+
+    /* Prevent any pending output from being written once more by the child. */
+    fflush(stdout);
+    fflush(stderr);
+
+    pid = fork();
+    if (pid < 0) {
+        RXP_LOG_ERROR("failed to fork a worker process\n");
+        close(task_fds[0]);
+        close(task_fds[1]);
+        close(result_fds[0]);
+        close(result_fds[1]);
+        return RX_ERROR;
+    }
+
+    if (pid == 0) {
+        size_t i;
+
+        /* Only keep the pipe ends that belong to this worker. */
+        for (i = 0; i < worker_count; ++i) {
+            rxp_fd_close(&workers[i].task_fd);
+            rxp_fd_close(&workers[i].result_fd);
+        }
+
+        close(task_fds[1]);
+        close(result_fds[0]);
+        signal(SIGPIPE, SIG_DFL);
+
+        _exit(rxp_worker_process_run(task_fds[0],
+                                     result_fds[1],
+                                     test_case_count,
+                                     test_cases,
+                                     options));
+    }
+
+    close(task_fds[0]);
+    close(result_fds[1]);
+
+    worker->pid = pid;
+    worker->task_fd = task_fds[1];
+    worker->result_fd = result_fds[0];
+    worker->task = RXP_WORKER_PROCESS_IDLE;
+    return RX_SUCCESS;
+}
+
+static void
+rxp_worker_process_reap(int *exit_status, struct rxp_worker_process *worker)
+{
+    RX_ASSERT(exit_status != NULL);
+    RX_ASSERT(worker != NULL);
+    RX_ASSERT(worker->pid > 0);
+
+    rxp_fd_close(&worker->task_fd);
+    rxp_fd_close(&worker->result_fd);
+
+    while (waitpid(worker->pid, exit_status, 0) < 0) {
+        if (errno != EINTR) {
+            RXP_LOG_DEBUG("failed to wait for a worker process\n");
+            *exit_status = 0;
+            break;
+        }
+    }
+
+    worker->pid = -1;
+}
+
+static enum rx_status
+rxp_worker_process_dispatch(struct rxp_worker_process *worker,
+                            size_t task,
+                            const struct rx_test_case *test_cases,
+                            const struct rxp_options *options)
+{
+    rx_size index;
+    rx_uint64 timeout_ms;
+
+    RX_ASSERT(worker != NULL);
+    RX_ASSERT(worker->task == RXP_WORKER_PROCESS_IDLE);
+    RX_ASSERT(test_cases != NULL);
+    RX_ASSERT(options != NULL);
+
+    /* Isolated test cases are timed out by the worker itself. */
+    timeout_ms = options->isolation_batch_size > 0
+                     ? 0
+                     : rxp_test_case_get_timeout(&test_cases[task], options);
+
+    index = (rx_size)task;
+    if (rxp_fd_write(worker->task_fd, &index, sizeof index) != RX_SUCCESS) {
+        return RX_ERROR;
+    }
+
+    if (rxp_get_real_time(&worker->started) != RX_SUCCESS) {
+        worker->started = 0;
+    }
+
+    worker->task = task;
+    worker->deadline
+        = timeout_ms > 0
+              ? worker->started + timeout_ms * (RXP_TICKS_PER_SECOND / 1000)
+              : 0;
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_worker_process_receive(int *received,
+                           enum rx_status *test_status,
+                           struct rxp_worker_process *worker,
+                           struct rx_summary *summaries,
+                           size_t summary_count)
+{
+    enum rx_status status;
+    struct rxp_reader reader;
+    rx_size size;
+    char *payload;
+    size_t index;
+
+    RX_ASSERT(received != NULL);
+    RX_ASSERT(worker != NULL);
+
+    /* Failing to read anything means that the worker terminated early. */
+    *received = RXP_FALSE;
+    if (rxp_fd_read(worker->result_fd, &size, sizeof size) != RX_SUCCESS) {
+        return RX_SUCCESS;
+    }
+
+    payload = (char *)RX_MALLOC((size_t)size);
+    if (payload == NULL) {
+        RXP_LOG_ERROR_1("failed to allocate the result of a worker process "
+                        "(%lu bytes)\n",
+                        (unsigned long)size);
+        return RX_ERROR_ALLOCATION;
+    }
+
+    if (rxp_fd_read(worker->result_fd, payload, (size_t)size) != RX_SUCCESS) {
+        RX_FREE(payload);
+        return RX_SUCCESS;
+    }
+
+    reader.it = payload;
+    reader.end = payload + size;
+    status = rxp_summary_deserialize(
+        &index, test_status, summaries, summary_count, &reader);
+    RX_FREE(payload);
+    if (status != RX_SUCCESS) {
+        RXP_LOG_ERROR("failed to deserialize the result of a worker "
+                      "process\n");
+        return status;
+    }
+
+    if (index != worker->task) {
+        RXP_LOG_ERROR("unexpected result from a worker process\n");
+        return RX_ERROR;
+    }
+
+    *received = RXP_TRUE;
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_run_test_cases_in_processes(struct rx_summary *summaries,
+                                size_t test_case_count,
+                                const struct rx_test_case *test_cases,
+                                const rx_uint64 *estimates,
+                                const struct rxp_options *options)
+{
+    enum rx_status status;
+    struct rxp_worker_process *workers;
+    struct pollfd *poll_fds;
+    char *completed;
+    struct rxp_scheduler scheduler;
+    size_t worker_count;
+    size_t task;
+    size_t done;
+    size_t printed;
+    size_t failed_count;
+    size_t i;
+    struct sigaction ignore_action;
+    struct sigaction previous_action;
+
+    RX_ASSERT(summaries != NULL);
+    RX_ASSERT(test_cases != NULL);
+    RX_ASSERT(test_case_count > 0);
+    RX_ASSERT(options != NULL);
+    RX_ASSERT(options->job_count > 1);
+
+    worker_count = options->job_count < test_case_count
+                       ? options->job_count
+                       : test_case_count;
+
+    workers = (struct rxp_worker_process *)RX_MALLOC(sizeof *workers
+                                                     * worker_count);
+    if (workers == NULL) {
+        RXP_LOG_ERROR("failed to allocate the worker processes\n");
+        return RX_ERROR_ALLOCATION;
+    }
+
+    poll_fds = (struct pollfd *)RX_MALLOC(sizeof *poll_fds * worker_count);
+    if (poll_fds == NULL) {
+        RXP_LOG_ERROR("failed to allocate the worker processes\n");
+        RX_FREE(workers);
+        return RX_ERROR_ALLOCATION;
+    }
+
+    completed = (char *)RX_MALLOC(sizeof *completed * test_case_count);
+    if (completed == NULL) {
+        RXP_LOG_ERROR("failed to allocate the worker processes\n");
+        RX_FREE(poll_fds);
+        RX_FREE(workers);
+        return RX_ERROR_ALLOCATION;
+    }
+
+    status = rxp_scheduler_create(&scheduler, worker_count, test_case_count);
+    if (status != RX_SUCCESS) {
+        RX_FREE(completed);
+        RX_FREE(poll_fds);
+        RX_FREE(workers);
+        return status;
+    }
+
+    rxp_scheduler_assign(&scheduler, estimates, 0, test_case_count);
+
+    memset(completed, 0, sizeof *completed * test_case_count);
+    for (i = 0; i < worker_count; ++i) {
+        workers[i].pid = -1;
+        workers[i].task_fd = -1;
+        workers[i].result_fd = -1;
+        workers[i].task = RXP_WORKER_PROCESS_IDLE;
+        workers[i].started = 0;
+        workers[i].deadline = 0;
+    }
+
+    /* Writing to a worker that terminated must not take the runner down. */
+    memset(&ignore_action, 0, sizeof ignore_action);
+    ignore_action.sa_handler = SIG_IGN;
+    sigemptyset(&ignore_action.sa_mask);
+    sigaction(SIGPIPE, &ignore_action, &previous_action);
+
+    status = RX_SUCCESS;
+    done = 0;
+    printed = 0;
+    failed_count = 0;
+
+    for (i = 0; i < worker_count; ++i) {
+        status = rxp_worker_process_spawn(
+            workers, worker_count, i, test_case_count, test_cases, options);
+        if (status != RX_SUCCESS) {
+            goto workers_cleanup;
+        }
+
+        rxp_scheduler_pop(&task, &scheduler, i);
+        status = rxp_worker_process_dispatch(
+            &workers[i], task, test_cases, options);
+        if (status != RX_SUCCESS) {
+            RXP_LOG_ERROR("failed to dispatch a test case to a worker "
+                          "process\n");
+            goto workers_cleanup;
+        }
+    }
+
+    while (done < test_case_count) {
+        size_t poll_fd_count;
+        uint64_t now;
+        uint64_t next_deadline;
+        int poll_timeout;
+        int ready;
+
+        if (rxp_get_real_time(&now) != RX_SUCCESS) {
+            now = 0;
+        }
+
+        poll_fd_count = 0;
+        next_deadline = (uint64_t)-1;
+        for (i = 0; i < worker_count; ++i) {
+            if (workers[i].task != RXP_WORKER_PROCESS_IDLE) {
+                poll_fds[poll_fd_count].fd = workers[i].result_fd;
+                poll_fds[poll_fd_count].events = POLLIN;
+                poll_fds[poll_fd_count].revents = 0;
+                ++poll_fd_count;
+
+                if (workers[i].deadline > 0
+                    && workers[i].deadline < next_deadline) {
+                    next_deadline = workers[i].deadline;
+                }
+            }
+        }
+
+        RX_ASSERT(poll_fd_count > 0);
+
+        if (next_deadline == (uint64_t)-1) {
+            poll_timeout = -1;
+        } else if (next_deadline <= now) {
+            poll_timeout = 0;
+        } else {
+            uint64_t remaining;
+
+            /* Round up to not wake up right before the deadline. */
+            remaining = (next_deadline - now + RXP_TICKS_PER_SECOND / 1000 - 1)
+                        / (RXP_TICKS_PER_SECOND / 1000);
+            poll_timeout = remaining > (uint64_t)INT_MAX ? INT_MAX
+                                                          : (int)remaining;
+        }
+
+        ready = poll(poll_fds, (nfds_t)poll_fd_count, poll_timeout);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            RXP_LOG_ERROR("failed to wait for the worker processes\n");
+            status = RX_ERROR;
+            goto workers_cleanup;
+        }
+
+        if (rxp_get_real_time(&now) != RX_SUCCESS) {
+            now = 0;
+        }
+
+        poll_fd_count = 0;
+        for (i = 0; i < worker_count; ++i) {
+            struct rxp_worker_process *worker;
+            enum rx_status test_status;
+            int received;
+
+            worker = &workers[i];
+            if (worker->task == RXP_WORKER_PROCESS_IDLE) {
+                continue;
+            }
+
+            task = worker->task;
+
+            if (poll_fds[poll_fd_count++].revents != 0) {
+                status = rxp_worker_process_receive(&received,
+                                                    &test_status,
+                                                    worker,
+                                                    summaries,
+                                                    test_case_count);
+                if (status != RX_SUCCESS) {
+                    goto workers_cleanup;
+                }
+
+                if (!received) {
+                    int exit_status;
+
+                    rxp_worker_process_reap(&exit_status, worker);
+                    status = rxp_summary_add_termination_failure(
+                        &summaries[task], exit_status, NULL, 0);
+                    if (status != RX_SUCCESS) {
+                        goto workers_cleanup;
+                    }
+                } else if (test_status != RX_SUCCESS) {
+                    RXP_LOG_ERROR_2("failed to run a test case "
+                                    "(suite: \"%s\", case: \"%s\")\n",
+                                    test_cases[task].suite_name,
+                                    test_cases[task].name);
+                    status = test_status;
+                    goto workers_cleanup;
+                }
+            } else if (worker->deadline > 0 && now >= worker->deadline) {
+                int exit_status;
+
+                /* The test case might be deadlocked, take no chances. */
+                kill(worker->pid, SIGKILL);
+                rxp_worker_process_reap(&exit_status, worker);
+
+                summaries[task].elapsed = now - worker->started;
+                status = rxp_summary_add_timeout_failure(
+                    &summaries[task],
+                    rxp_test_case_get_timeout(&test_cases[task], options));
+                if (status != RX_SUCCESS) {
+                    goto workers_cleanup;
+                }
+            } else {
+                continue;
+            }
+
+            if (worker->pid < 0 && scheduler.remaining > 0) {
+                status = rxp_worker_process_spawn(workers,
+                                                  worker_count,
+                                                  i,
+                                                  test_case_count,
+                                                  test_cases,
+                                                  options);
+                if (status != RX_SUCCESS) {
+                    goto workers_cleanup;
+                }
+            }
+
+            worker->task = RXP_WORKER_PROCESS_IDLE;
+            completed[task] = 1;
+            ++done;
+
+            /* Print the summaries in order, as soon as they're available. */
+            while (printed < test_case_count && completed[printed]) {
+                rxp_summary_report(&summaries[printed], options);
+                ++printed;
+            }
+
+            if (rxp_failure_budget_consume(&failed_count,
+                                           &summaries[task],
+                                           options->max_failure_count)) {
+                status = RX_ERROR_CANCELLED;
+                goto workers_cleanup;
+            }
+
+            if (worker->pid < 0) {
+                continue;
+            }
+
+            if (rxp_scheduler_pop(&task, &scheduler, i)) {
+                status = rxp_worker_process_dispatch(
+                    worker, task, test_cases, options);
+                if (status != RX_SUCCESS) {
+                    RXP_LOG_ERROR("failed to dispatch a test case to "
+                                  "a worker process\n");
+                    goto workers_cleanup;
+                }
+            } else {
+                /* Let the worker know that there's nothing left to do. */
+                rxp_fd_close(&worker->task_fd);
+            }
+        }
+    }
+
+workers_cleanup:
+    for (i = 0; i < worker_count; ++i) {
+        int exit_status;
+
+        if (workers[i].pid < 0) {
+            continue;
+        }
+
+        if (status != RX_SUCCESS) {
+            kill(workers[i].pid, SIGKILL);
+        }
+
+        rxp_worker_process_reap(&exit_status, &workers[i]);
+    }
+
+    if (status == RX_ERROR_CANCELLED) {
+        rxp_failure_budget_skip_pending(
+            summaries, completed, printed, test_case_count);
+
+        /* Report the test cases that completed out of order. */
+        for (; printed < test_case_count; ++printed) {
+            if (completed[printed]) {
+                rxp_summary_report(&summaries[printed], options);
+            }
+        }
+    }
+
+    sigaction(SIGPIPE, &previous_action, NULL);
+
+    rxp_scheduler_destroy(&scheduler);
+    RX_FREE(completed);
+    RX_FREE(poll_fds);
+    RX_FREE(workers);
+    return status;
+}
+#endif /* RXP_HAS_FORK */
+
+/* Implementation: Worker Threads                                  O-(''Q)
+   -------------------------------------------------------------------------- */
+
+#if RXP_HAS_THREADS
+/*
+   The test cases are handed out to the worker threads in consecutive ranges of
+   parallel-safe test cases, while the ones that aren't safe to run
+   concurrently are run in-between by the main thread, once all the workers
+   became idle. Each worker runs its test cases with its own context and
+   summary, meaning that no lock is needed while assessing the tests.
+*/
+struct rxp_thread_pool {
+    pthread_mutex_t mutex;
+    pthread_cond_t task_available;
+    pthread_cond_t task_completed;
+    struct rx_summary *summaries;
+    const struct rx_test_case *test_cases;
+    char *completed;
+    struct rxp_scheduler scheduler;
+    struct rxp_watchdog *watchdog;
+    const struct rxp_options *options;
+    size_t failed_count;
+    int quit;
+    enum rx_status status;
+};
+
+struct rxp_worker_thread {
+    pthread_t thread;
+    struct rxp_thread_pool *pool;
+    size_t index;
+    struct rxp_data_pool data_pool;
+};
+
+static void *
+rxp_worker_thread_run(void *arg)
+{
+    struct rxp_worker_thread *worker;
+    struct rxp_thread_pool *pool;
+
+    worker = (struct rxp_worker_thread *)arg;
+    pool = worker->pool;
+
+    pthread_mutex_lock(&pool->mutex);
+
+    for (;;) {
+        enum rx_status status;
+        size_t task;
+
+        while (!pool->quit
+               && !rxp_scheduler_pop(&task, &pool->scheduler, worker->index)) {
+            pthread_cond_wait(&pool->task_available, &pool->mutex);
+        }
+
+        if (pool->quit) {
+            break;
+        }
+
+        pthread_mutex_unlock(&pool->mutex);
+
+        status = rxp_test_case_execute(
+            &pool->summaries[task],
+            &pool->test_cases[task],
+            rxp_watchdog_get_slot(pool->watchdog, worker->index),
+            &worker->data_pool,
+            pool->options);
+        if (status != RX_SUCCESS) {
+            RXP_LOG_ERROR_2("failed to run a test case "
+                            "(suite: \"%s\", case: \"%s\")\n",
+                            pool->test_cases[task].suite_name,
+                            pool->test_cases[task].name);
+        }
+
+        pthread_mutex_lock(&pool->mutex);
+
+        if (status != RX_SUCCESS && pool->status == RX_SUCCESS) {
+            pool->status = status;
+        }
+
+        /* Stop handing out new test cases once the budget is exhausted. */
+        if (status == RX_SUCCESS
+            && rxp_failure_budget_consume(&pool->failed_count,
+                                          &pool->summaries[task],
+                                          pool->options->max_failure_count)
+            && pool->status == RX_SUCCESS) {
+            pool->status = RX_ERROR_CANCELLED;
+            pool->quit = 1;
+        }
+
+        pool->completed[task] = 1;
+        pthread_cond_broadcast(&pool->task_completed);
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+    return NULL;
+}
+
+static enum rx_status
+rxp_run_test_cases_in_threads(struct rx_summary *summaries,
+                              size_t test_case_count,
+                              const struct rx_test_case *test_cases,
+                              const rx_uint64 *estimates,
+                              struct rxp_watchdog *watchdog,
+                              struct rxp_data_pool *data_pool,
+                              const struct rxp_options *options)
+{
+    enum rx_status status;
+    struct rxp_thread_pool pool;
+    struct rxp_worker_thread *workers;
+    size_t worker_count;
+    size_t printed;
+    size_t i;
+
+    RX_ASSERT(summaries != NULL);
+    RX_ASSERT(test_cases != NULL);
+    RX_ASSERT(test_case_count > 0);
+    RX_ASSERT(options != NULL);
+    RX_ASSERT(options->thread_count > 1);
+
+    worker_count = options->thread_count < test_case_count
+                       ? options->thread_count
+                       : test_case_count;
+
+    workers = (struct rxp_worker_thread *)RX_MALLOC(sizeof *workers
+                                                    * worker_count);
+    if (workers == NULL) {
+        RXP_LOG_ERROR("failed to allocate the worker threads\n");
+        return RX_ERROR_ALLOCATION;
+    }
+
+    pool.completed = (char *)RX_MALLOC(sizeof *pool.completed
+                                       * test_case_count);
+    if (pool.completed == NULL) {
+        RXP_LOG_ERROR("failed to allocate the worker threads\n");
+        RX_FREE(workers);
+        return RX_ERROR_ALLOCATION;
+    }
+
+    status = rxp_scheduler_create(
+        &pool.scheduler, worker_count, test_case_count);
+    if (status != RX_SUCCESS) {
+        RX_FREE(pool.completed);
+        RX_FREE(workers);
+        return status;
+    }
+
+    memset(pool.completed, 0, sizeof *pool.completed * test_case_count);
+    pool.summaries = summaries;
+    pool.test_cases = test_cases;
+    pool.watchdog = watchdog;
+    pool.options = options;
+    pool.failed_count = 0;
+    pool.quit = 0;
+    pool.status = RX_SUCCESS;
+
+    pthread_mutex_init(&pool.mutex, NULL);
+    pthread_cond_init(&pool.task_available, NULL);
+    pthread_cond_init(&pool.task_completed, NULL);
+
+    status = RX_SUCCESS;
+    printed = 0;
+
+    for (i = 0; i < worker_count; ++i) {
+        workers[i].pool = &pool;
+        workers[i].index = i;
+        rxp_data_pool_initialize(&workers[i].data_pool);
+        if (pthread_create(
+                &workers[i].thread, NULL, rxp_worker_thread_run, &workers[i])
+            != 0) {
+            RXP_LOG_ERROR("failed to create a worker thread\n");
+            status = RX_ERROR;
+            worker_count = i;
+            goto threads_cleanup;
+        }
+    }
+
+    while (printed < test_case_count) {
+        size_t end;
+
+        if (!test_cases[printed].config.parallel_safe
+            || rxp_test_case_needs_process(&test_cases[printed], options)) {
+            /* All the workers are idle at this point. */
+            status = rxp_test_case_execute(
+                &summaries[printed],
+                &test_cases[printed],
+                rxp_watchdog_get_slot(watchdog, options->thread_count),
+                data_pool,
+                options);
+            if (status != RX_SUCCESS) {
+                RXP_LOG_ERROR_2("failed to run a test case "
+                                "(suite: \"%s\", case: \"%s\")\n",
+                                test_cases[printed].suite_name,
+                                test_cases[printed].name);
+                goto threads_cleanup;
+            }
+
+            rxp_summary_report(&summaries[printed], options);
+
+            if (rxp_failure_budget_consume(&pool.failed_count,
+                                           &summaries[printed],
+                                           options->max_failure_count)) {
+                status = RX_ERROR_CANCELLED;
+                ++printed;
+                goto threads_cleanup;
+            }
+
+            ++printed;
+            continue;
+        }
+
+        end = printed + 1;
+        while (end < test_case_count && test_cases[end].config.parallel_safe
+               && !rxp_test_case_needs_process(&test_cases[end], options)) {
+            ++end;
+        }
+
+        pthread_mutex_lock(&pool.mutex);
+        rxp_scheduler_assign(&pool.scheduler, estimates, printed, end);
+        pthread_cond_broadcast(&pool.task_available);
+        pthread_mutex_unlock(&pool.mutex);
+
+        /* Print the summaries in order, as soon as they're available. */
+        for (; printed < end; ++printed) {
+            pthread_mutex_lock(&pool.mutex);
+
+            while (!pool.completed[printed] && pool.status == RX_SUCCESS) {
+                pthread_cond_wait(&pool.task_completed, &pool.mutex);
+            }
+
+            status = pool.status;
+            pthread_mutex_unlock(&pool.mutex);
+
+            if (status != RX_SUCCESS) {
+                goto threads_cleanup;
+            }
+
+            rxp_summary_report(&summaries[printed], options);
+        }
+    }
+
+threads_cleanup:
+    pthread_mutex_lock(&pool.mutex);
+    pool.quit = 1;
+    pthread_cond_broadcast(&pool.task_available);
+    pthread_mutex_unlock(&pool.mutex);
+
+    for (i = 0; i < worker_count; ++i) {
+        pthread_join(workers[i].thread, NULL);
+        rxp_data_pool_terminate(&workers[i].data_pool);
+    }
+
+    if (status == RX_ERROR_CANCELLED) {
+        rxp_failure_budget_skip_pending(
+            summaries, pool.completed, printed, test_case_count);
+
+        /* Report the test cases that completed out of order. */
+        for (; printed < test_case_count; ++printed) {
+            if (pool.completed[printed]) {
+                rxp_summary_report(&summaries[printed], options);
+            }
+        }
+    }
+
+    pthread_cond_destroy(&pool.task_completed);
+    pthread_cond_destroy(&pool.task_available);
+    pthread_mutex_destroy(&pool.mutex);
+
+    rxp_scheduler_destroy(&pool.scheduler);
+    RX_FREE(pool.completed);
+    RX_FREE(workers);
+    return status;
+}
+#endif /* RXP_HAS_THREADS */
+
+/* Implementation: Repeat                                          O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   When running the test cases repeatedly, statistics are aggregated for each
+   test case across the passes.
+*/
+
+struct rxp_repeat_stats {
+    size_t passed;
+    size_t failed;
+    rx_uint64 min;
+    rx_uint64 max;
+    rx_uint64 total;
+};
+
+static void
+rxp_repeat_stats_add(struct rxp_repeat_stats *stats,
+                     const struct rx_summary *summary)
+{
+    RX_ASSERT(stats != NULL);
+    RX_ASSERT(summary != NULL);
+
+    if (summary->skipped) {
+        return;
+    }
+
+    if (stats->passed + stats->failed == 0 || summary->elapsed < stats->min) {
+        stats->min = summary->elapsed;
+    }
+
+    if (summary->elapsed > stats->max) {
+        stats->max = summary->elapsed;
+    }
+
+    stats->total += summary->elapsed;
+
+    if (summary->failure_count > 0) {
+        ++stats->failed;
+    } else {
+        ++stats->passed;
+    }
+}
+
+static void
+rxp_repeat_stats_print(const struct rxp_repeat_stats *stats,
+                       const struct rx_summary *summaries,
+                       size_t summary_count)
+{
+    size_t i;
+
+    RX_ASSERT(stats != NULL);
+    RX_ASSERT(summaries != NULL);
+
+    RXP_LOCK_FILE(stderr);
+
+    for (i = 0; i < summary_count; ++i) {
+        const struct rx_test_case *test_case;
+        size_t run_count;
+
+        test_case = summaries[i].test_case;
+        run_count = stats[i].passed + stats[i].failed;
+        if (run_count == 0) {
+            continue;
+        }
+
+        fprintf(stderr,
+                "[REPEAT] \"%s\" / \"%s\": %lu passed, %lu failed "
+                "(min: %f ms, mean: %f ms, max: %f ms)\n",
+                test_case->suite_name,
+                test_case->name,
+                (unsigned long)stats[i].passed,
+                (unsigned long)stats[i].failed,
+                (double)stats[i].min * (1000.0 / RXP_TICKS_PER_SECOND),
+                (double)stats[i].total / (double)run_count
+                    * (1000.0 / RXP_TICKS_PER_SECOND),
+                (double)stats[i].max * (1000.0 / RXP_TICKS_PER_SECOND));
+    }
+
+    RXP_UNLOCK_FILE(stderr);
+}
+
+/* Implementation: Cache                                           O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   Test cases that passed can be recorded in a cache file along with their
+   fingerprint, for the next runs to skip them for as long as their
+   fingerprint remains the same.
+
+   The code of a test case can't be reliably hashed in a portable way, so
+   the fingerprint is instead a 64-bit FNV-1a hash of a key supplied by the
+   user, meant to be derived from the build and its inputs, of the full name
+   of the test case, and of its config.
+*/
+
+struct rxp_cache {
+    struct rxp_records records;
+    rx_uint64 *fingerprints;
+};
+
+static void
+rxp_hash_bytes(rx_uint64 *hash, const void *data, size_t size)
+{
+    /* FNV-1a 64-bit prime, built from 32-bit halves to remain C89-friendly. */
+    static const rx_uint64 prime = ((rx_uint64)0x00000100u << 32) | 0x000001B3u;
+    const unsigned char *it;
+    const unsigned char *end;
+
+    RX_ASSERT(hash != NULL);
+    RX_ASSERT(data != NULL);
+
+    it = (const unsigned char *)data;
+    end = it + size;
+    for (; it != end; ++it) {
+        *hash = (*hash ^ (rx_uint64)*it) * prime;
+    }
+}
+
+static rx_uint64
+rxp_test_case_fingerprint(const struct rx_test_case *test_case,
+                          const char *key)
+{
+    rx_uint64 hash;
+
+    RX_ASSERT(test_case != NULL);
+    RX_ASSERT(key != NULL);
+
+    hash = ((rx_uint64)0xCBF29CE4u << 32) | 0x84222325u;
+
+    /* Include the terminating null characters to delimit the strings. */
+    rxp_hash_bytes(&hash, key, strlen(key) + 1);
+    rxp_hash_bytes(
+        &hash, test_case->suite_name, strlen(test_case->suite_name) + 1);
+    rxp_hash_bytes(&hash, test_case->name, strlen(test_case->name) + 1);
+    rxp_hash_bytes(
+        &hash, &test_case->config.skip, sizeof test_case->config.skip);
+    rxp_hash_bytes(&hash,
+                   &test_case->config.parallel_safe,
+                   sizeof test_case->config.parallel_safe);
+    rxp_hash_bytes(&hash,
+                   &test_case->config.timeout_ms,
+                   sizeof test_case->config.timeout_ms);
+    rxp_hash_bytes(&hash,
+                   &test_case->config.fixture.size,
+                   sizeof test_case->config.fixture.size);
+    rxp_hash_bytes(&hash,
+                   &test_case->config.shared_fixture.size,
+                   sizeof test_case->config.shared_fixture.size);
+    return hash;
+}
+
+static void
+rxp_cache_destroy(struct rxp_cache *cache)
+{
+    RX_ASSERT(cache != NULL);
+
+    RX_FREE(cache->fingerprints);
+    rxp_records_destroy(&cache->records);
+}
+
+static enum rx_status
+rxp_cache_load(struct rxp_cache *cache, const char *path)
+{
+    RX_ASSERT(cache != NULL);
+    RX_ASSERT(path != NULL);
+
+    cache->fingerprints = NULL;
+    return rxp_records_load(&cache->records, path);
+}
+
+static enum rx_status
+rxp_cache_print_hit(const struct rx_test_case *test_case)
+{
+    enum rx_status status;
+    struct rx_summary summary;
+
+    status = rx_summary_initialize(&summary, test_case);
+    if (status != RX_SUCCESS) {
+        return status;
+    }
+
+    summary.cached = 1;
+    rx_summary_print(&summary);
+    rx_summary_terminate(&summary);
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_cache_select(struct rxp_cache *cache,
+                 size_t *test_case_count,
+                 struct rx_test_case *test_cases,
+                 const struct rxp_options *options)
+{
+    size_t i;
+    size_t count;
+
+    RX_ASSERT(cache != NULL);
+    RX_ASSERT(test_case_count != NULL);
+    RX_ASSERT(test_cases != NULL);
+    RX_ASSERT(options != NULL);
+    RX_ASSERT(options->cache_key != NULL);
+
+    cache->fingerprints = (rx_uint64 *)RX_MALLOC(
+        sizeof *cache->fingerprints * *test_case_count);
+    if (cache->fingerprints == NULL) {
+        RXP_LOG_ERROR("failed to allocate the fingerprints\n");
+        return RX_ERROR_ALLOCATION;
+    }
+
+    /* Compact the test cases that need to run at the front. */
+    count = 0;
+    for (i = 0; i < *test_case_count; ++i) {
+        struct rxp_record *record;
+        rx_uint64 fingerprint;
+
+        fingerprint
+            = rxp_test_case_fingerprint(&test_cases[i], options->cache_key);
+        record = rxp_records_find(&cache->records, &test_cases[i]);
+
+        if (!options->no_cache && record != NULL
+            && record->value == fingerprint
+            && !rxp_test_case_is_skipped(&test_cases[i])) {
+            enum rx_status status;
+
+            /* Leave the record unmatched for it to be saved back as is. */
+            status = rxp_cache_print_hit(&test_cases[i]);
+            if (status != RX_SUCCESS) {
+                return status;
+            }
+
+            continue;
+        }
+
+        /* Any outdated record is replaced once the test case ran. */
+        if (record != NULL) {
+            record->matched = 1;
+        }
+
+        test_cases[count] = test_cases[i];
+        cache->fingerprints[count] = fingerprint;
+        ++count;
+    }
+
+    *test_case_count = count;
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_cache_save(const struct rxp_cache *cache,
+               const char *path,
+               const struct rx_summary *summaries,
+               const struct rxp_repeat_stats *stats,
+               size_t summary_count)
+{
+    FILE *file;
+    size_t i;
+
+    RX_ASSERT(cache != NULL);
+    RX_ASSERT(cache->fingerprints != NULL);
+    RX_ASSERT(path != NULL);
+    RX_ASSERT(summaries != NULL);
+
+    file = fopen(path, "wb");
+    if (file == NULL) {
+        RXP_LOG_ERROR_1("failed to open the cache file `%s`\n", path);
+        return RX_ERROR;
+    }
+
+    for (i = 0; i < summary_count; ++i) {
+        const struct rx_summary *summary;
+        int passed;
+
+        summary = &summaries[i];
+
+        /* When repeating, the test case must have passed every time. */
+        passed = !summary->skipped && summary->error == NULL
+                 && (stats == NULL ? summary->failure_count == 0
+                                   : stats[i].failed == 0);
+        if (passed) {
+            rxp_record_write(file,
+                             summary->test_case->suite_name,
+                             summary->test_case->name,
+                             cache->fingerprints[i]);
+        }
+    }
+
+    /* Keep the records that are still valid or that weren't part of the run. */
+    for (i = 0; i < cache->records.count; ++i) {
+        const struct rxp_record *record;
+
+        record = &cache->records.entries[i];
+        if (!record->matched) {
+            rxp_record_write(
+                file, record->suite_name, record->name, record->value);
+        }
+    }
+
+    if (fclose(file) != 0) {
+        RXP_LOG_ERROR_1("failed to write the cache file `%s`\n", path);
+        return RX_ERROR;
+    }
+
+    return RX_SUCCESS;
+}
+
+/* Implementation: Last Run                                        O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   The test cases that failed are recorded in a last run file, for the next
+   runs to either run them first or to only run them. Each record stores the
+   number of passes that failed.
+*/
+
+static enum rx_status
+rxp_last_run_select(struct rxp_records *last_run,
+                    size_t *test_case_count,
+                    struct rx_test_case *test_cases,
+                    const struct rxp_options *options)
+{
+    struct rx_test_case *others;
+    size_t i;
+    size_t count;
+    size_t other_count;
+
+    RX_ASSERT(last_run != NULL);
+    RX_ASSERT(test_case_count != NULL);
+    RX_ASSERT(test_cases != NULL);
+    RX_ASSERT(options != NULL);
+
+    RX_ASSERT(options->failed_first || options->last_failed);
+
+    if (options->last_failed && last_run->count == 0) {
+        RXP_LOG_INFO("no failed test cases were recorded, running all of "
+                     "them\n");
+        return RX_SUCCESS;
+    }
+
+    others = NULL;
+    if (!options->last_failed) {
+        others = (struct rx_test_case *)RX_MALLOC(sizeof *others
+                                                  * *test_case_count);
+        if (others == NULL) {
+            RXP_LOG_ERROR("failed to allocate the reordered test cases\n");
+            return RX_ERROR_ALLOCATION;
+        }
+    }
+
+    /* Partition in a stable way to preserve the current order. */
+    count = 0;
+    other_count = 0;
+    for (i = 0; i < *test_case_count; ++i) {
+        if (rxp_records_find(last_run, &test_cases[i]) != NULL) {
+            test_cases[count++] = test_cases[i];
+        } else if (others != NULL) {
+            others[other_count++] = test_cases[i];
+        }
+    }
+
+    if (others != NULL) {
+        memcpy(&test_cases[count], others, sizeof *others * other_count);
+        count += other_count;
+        RX_FREE(others);
+    }
+
+    *test_case_count = count;
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_last_run_save(struct rxp_records *last_run,
+                  const char *path,
+                  const struct rx_summary *summaries,
+                  const struct rxp_repeat_stats *stats,
+                  size_t summary_count)
+{
+    FILE *file;
+    size_t i;
+
+    RX_ASSERT(last_run != NULL);
+    RX_ASSERT(path != NULL);
+    RX_ASSERT(summaries != NULL);
+
+    file = fopen(path, "wb");
+    if (file == NULL) {
+        RXP_LOG_ERROR_1("failed to open the last run file `%s`\n", path);
+        return RX_ERROR;
+    }
+
+    for (i = 0; i < summary_count; ++i) {
+        const struct rx_summary *summary;
+        struct rxp_record *record;
+        rx_uint64 failed_count;
+
+        summary = &summaries[i];
+        record = rxp_records_find(last_run, summary->test_case);
+        if (record != NULL) {
+            record->matched = 1;
+        }
+
+        /* A test case that was skipped keeps its previous state. */
+        if (summary->skipped) {
+            if (record != NULL) {
+                rxp_record_write(
+                    file, record->suite_name, record->name, record->value);
+            }
+
+            continue;
+        }
+
+        failed_count = stats == NULL ? (rx_uint64)(summary->failure_count > 0)
+                                     : (rx_uint64)stats[i].failed;
+        if (failed_count > 0) {
+            rxp_record_write(file,
+                             summary->test_case->suite_name,
+                             summary->test_case->name,
+                             failed_count);
+        }
+    }
+
+    /* Keep the failures of the test cases that weren't part of this run. */
+    for (i = 0; i < last_run->count; ++i) {
+        const struct rxp_record *record;
+
+        record = &last_run->entries[i];
+        if (!record->matched) {
+            rxp_record_write(
+                file, record->suite_name, record->name, record->value);
+        }
+    }
+
+    if (fclose(file) != 0) {
+        RXP_LOG_ERROR_1("failed to write the last run file `%s`\n", path);
+        return RX_ERROR;
+    }
+
+    return RX_SUCCESS;
+}
+
+/* Implementation: Helpers                                         O-(''Q)
+   -------------------------------------------------------------------------- */
+
+static int
+rxp_compare_test_case_names(const char *a, const char *b)
+{
+    const char *a_index;
+    const char *b_index;
+    size_t a_size;
+    size_t b_size;
+
+    /* Keep the rows of parameterized test cases in the order of their index. */
+    a_index = strrchr(a, '[');
+    b_index = strrchr(b, '[');
+    if (a_index != NULL && b_index != NULL && a_index - a == b_index - b
+        && strncmp(a, b, (size_t)(a_index - a)) == 0) {
+        a_size = strlen(a_index);
+        b_size = strlen(b_index);
+        if (a_size != b_size) {
+            return a_size < b_size ? -1 : 1;
+        }
+    }
+
+    return strcmp(a, b);
+}
+
+RXP_MAYBE_UNUSED static int
+rxp_compare_test_cases(const void *a, const void *b)
+{
+    int out;
+    const struct rx_test_case *aa;
+    const struct rx_test_case *bb;
+
+    aa = (const struct rx_test_case *)a;
+    bb = (const struct rx_test_case *)b;
+
+    out = strcmp(aa->suite_name, bb->suite_name);
+    if (out != 0) {
+        return out;
+    }
+
+    return rxp_compare_test_case_names(aa->name, bb->name);
+}
+
+RXP_MAYBE_UNUSED static rx_size
+rxp_test_case_desc_get_row_count(const struct rxp_test_case_desc *desc)
+{
+    if (desc == NULL) {
+        return 0;
+    }
+
+    return desc->params == NULL ? 1 : desc->params->row_count;
+}
+
+RXP_MAYBE_UNUSED static const char *
+rxp_test_case_desc_get_name(const struct rxp_test_case_desc *desc, rx_size row)
+{
+    char *name;
+
+    RX_ASSERT(desc != NULL);
+
+    if (desc->params == NULL) {
+        return desc->name;
+    }
+
+    RX_ASSERT(row < desc->params->row_count);
+
+    name = &desc->params->names[row * desc->params->name_size];
+    if (name[0] == '\0') {
+        sprintf(name, "%s[%lu]", desc->name, (unsigned long)row);
+    }
+
+    return name;
+}
+
+RXP_MAYBE_UNUSED static enum rx_status
+rxp_test_case_desc_match(int *matched,
+                         const struct rxp_test_case_desc *desc,
+                         rx_size row,
+                         const struct rxp_filter *filter)
+{
+    RX_ASSERT(matched != NULL);
+
+    if (desc == NULL) {
+        *matched = RXP_FALSE;
+        return RX_SUCCESS;
+    }
+
+    if (filter == NULL || filter->count == 0) {
+        *matched = RXP_TRUE;
+        return RX_SUCCESS;
+    }
+
+    return rxp_filter_match(matched,
+                            filter,
+                            desc->suite_name,
+                            rxp_test_case_desc_get_name(desc, row));
+}
+
+#if RXP_TEST_DISCOVERY
+static void
+rxp_test_case_desc_get_config(
+    struct rxp_test_case_config_blueprint *config_blueprint,
+    const struct rxp_test_case_desc *desc)
+{
+    const struct rxp_test_suite_desc * const *s_it;
+
+    RX_ASSERT(config_blueprint != NULL);
+    RX_ASSERT(desc != NULL);
+
+    /* Find the corresponding test suite description, if any. */
+    for (s_it = RXP_TEST_SUITE_SECTION_BEGIN;
+         s_it != RXP_TEST_SUITE_SECTION_END;
+         ++s_it) {
+        if (*s_it == NULL) {
+            continue;
+        }
+
+        if (strcmp((*s_it)->name, desc->suite_name) == 0) {
+            break;
+        }
+    }
+
+    memset(config_blueprint, 0, sizeof *config_blueprint);
+
+    if (s_it != RXP_TEST_SUITE_SECTION_END && (*s_it)->config_desc != NULL) {
+        /* Inherit the config from the test suite's description. */
+        (*s_it)->config_desc->update(config_blueprint);
+    }
+
+    if (desc->config_desc != NULL) {
+        /* Inherit the config from the test case's description. */
+        desc->config_desc->update(config_blueprint);
+    }
+}
+#endif /* RXP_TEST_DISCOVERY */
+
+static enum rx_status
+rxp_enumerate_test_cases(rx_size *test_case_count,
+                         struct rx_test_case *test_cases,
+                         const struct rxp_filter *filter)
+{
+    enum rx_status status;
+    size_t i;
+    rx_size row;
+    int matched;
+    const struct rxp_test_case_desc * const *c_it;
+
+    RX_ASSERT(test_case_count != NULL);
+
+#if !RXP_TEST_DISCOVERY
+    RXP_UNUSED(test_cases);
+    RXP_UNUSED(filter);
+    RXP_UNUSED(status);
+    RXP_UNUSED(i);
+    RXP_UNUSED(row);
+    RXP_UNUSED(matched);
+    RXP_UNUSED(c_it);
+
+    *test_case_count = 0;
+    return RX_SUCCESS;
+#else
+    /*
+       Filter the test cases out while enumerating them, so that the ones
+       being left out don't cost anything.
+    */
+    if (test_cases == NULL) {
+        *test_case_count = 0;
+        for (c_it = RXP_TEST_CASE_SECTION_BEGIN;
+             c_it != RXP_TEST_CASE_SECTION_END;
+             ++c_it) {
+            for (row = 0; row < rxp_test_case_desc_get_row_count(*c_it);
+                 ++row) {
+                status = rxp_test_case_desc_match(
+                    &matched, *c_it, row, filter);
+                if (status != RX_SUCCESS) {
+                    return status;
+                }
+
+                *test_case_count += (rx_size)matched;
+            }
+        }
+
+        return RX_SUCCESS;
+    }
+
+    i = 0;
+    for (c_it = RXP_TEST_CASE_SECTION_BEGIN;
+         c_it != RXP_TEST_CASE_SECTION_END;
+         ++c_it) {
+        struct rxp_test_case_config_blueprint config_blueprint;
+        struct rx_test_case *test_case;
+
+        if (*c_it == NULL) {
+            continue;
+        }
+
+        rxp_test_case_desc_get_config(&config_blueprint, *c_it);
+
+        for (row = 0; row < rxp_test_case_desc_get_row_count(*c_it); ++row) {
+            status = rxp_test_case_desc_match(&matched, *c_it, row, filter);
+            if (status != RX_SUCCESS) {
+                return status;
+            }
+
+            if (!matched) {
+                continue;
+            }
+
+            test_case = &test_cases[i];
+
+            test_case->suite_name = (*c_it)->suite_name;
+            test_case->name = rxp_test_case_desc_get_name(*c_it, row);
+            test_case->run = (*c_it)->run;
+
+            test_case->config.skip = config_blueprint.skip;
+            test_case->config.parallel_safe = config_blueprint.parallel_safe;
+            test_case->config.timeout_ms = config_blueprint.timeout_ms;
+
+            rxp_fixture_initialize(&test_case->config.fixture,
+                                   config_blueprint.fixture);
+            rxp_fixture_initialize(&test_case->config.shared_fixture,
+                                   config_blueprint.shared_fixture);
+            test_case->config.session_fixture
+                = config_blueprint.session_fixture;
+
+            test_case->param
+                = (*c_it)->params == NULL
+                      ? NULL
+                      : (const char *)(*c_it)->params->table
+                            + row * (*c_it)->params->row_size;
+            test_case->benchmark = (*c_it)->benchmark;
+
+            ++i;
+        }
+    }
+
+    RX_ASSERT(i == *test_case_count);
+
+    /* Objects that are defined in a custom memory section can only be retrieved
+       in an undefined order, so these need to be manually sorted afterwards
+       in a sensible way. */
+    qsort(test_cases,
+          *test_case_count,
+          sizeof *test_cases,
+          rxp_compare_test_cases);
+
+    return RX_SUCCESS;
+#endif
+}
+
+static int
+rxp_compare_summaries_by_test_suite(const void *a, const void *b)
+{
+    const struct rx_summary *aa;
+    const struct rx_summary *bb;
+
+    aa = (const struct rx_summary *)a;
+    bb = (const struct rx_summary *)b;
+    return strcmp(aa->test_case->suite_name, bb->test_case->suite_name);
+}
+
+static void
+rxp_real_are_equal_fuzzy(int *result, rxp_real a, rxp_real b, rxp_real tol)
+{
+    rxp_real diff;
+    rxp_real abs_a;
+    rxp_real abs_b;
+
+    diff = a > b ? a - b : b - a;
+    if (diff <= tol) {
+        *result = 1;
+        return;
+    }
+
+    abs_a = a < 0 ? -a : a;
+    abs_b = b < 0 ? -b : b;
+    *result = diff <= (abs_a > abs_b ? abs_a : abs_b) * tol;
+}
+
+static void
+rxp_str_are_equal(int *result, const char *a, const char *b)
+{
+    while (*a != '\0') {
+        if (*a != *b) {
+            *result = 0;
+            return;
+        }
+
+        ++a;
+        ++b;
+    }
+
+    *result = *a == *b;
+}
+
+static void
+rxp_str_are_equal_no_case(int *result, const char *a, const char *b)
+{
+    while (*a != '\0') {
+        if (tolower(*a) != tolower(*b)) {
+            *result = 0;
+            return;
+        }
+
+        ++a;
+        ++b;
+    }
+
+    *result = tolower(*a) == tolower(*b);
+}
+
+static void
+rxp_estimate_durations(rx_uint64 *estimates,
+                       struct rxp_records *timings,
+                       size_t test_case_count,
+                       const struct rx_test_case *test_cases)
+{
+    size_t i;
+    rx_uint64 longest;
+
+    RX_ASSERT(estimates != NULL);
+    RX_ASSERT(timings != NULL);
+    RX_ASSERT(test_cases != NULL);
+
+    longest = 0;
+    for (i = 0; i < timings->count; ++i) {
+        if (timings->entries[i].value > longest) {
+            longest = timings->entries[i].value;
+        }
+    }
+
+    /* Test cases without timings could be long, schedule them early. */
+    for (i = 0; i < test_case_count; ++i) {
+        const struct rxp_record *timing;
+
+        timing = rxp_records_find(timings, &test_cases[i]);
+        estimates[i] = timing == NULL ? longest : timing->value;
+    }
+}
+
+static rx_uint32
+rxp_test_case_hash(const struct rx_test_case *test_case)
+{
+    /* FNV-1a hash of `suite_name/name`, stable across runs and platforms. */
+    rx_uint32 hash;
+    const char *it;
+
+    RX_ASSERT(test_case != NULL);
+
+    hash = 2166136261u;
+
+    for (it = test_case->suite_name; *it != '\0'; ++it) {
+        hash = (hash ^ (rx_uint32)(unsigned char)*it) * 16777619u;
+    }
+
+    hash = (hash ^ (rx_uint32)'/') * 16777619u;
+
+    for (it = test_case->name; *it != '\0'; ++it) {
+        hash = (hash ^ (rx_uint32)(unsigned char)*it) * 16777619u;
+    }
+
+    return hash;
+}
+
+static rx_uint32
+rxp_random_next(rx_uint32 *state)
+{
+    /* Weyl sequence passed through the finalizer of MurmurHash3. */
+    rx_uint32 x;
+
+    RX_ASSERT(state != NULL);
+
+    *state = (*state + 0x9E3779B9u) & 0xFFFFFFFFu;
+
+    x = *state;
+    x ^= x >> 16;
+    x = (x * 0x85EBCA6Bu) & 0xFFFFFFFFu;
+    x ^= x >> 13;
+    x = (x * 0xC2B2AE35u) & 0xFFFFFFFFu;
+    x ^= x >> 16;
+    return x;
+}
+
+static size_t
+rxp_random_below(rx_uint32 *state, size_t bound)
+{
+    rx_uint32 threshold;
+
+    RX_ASSERT(bound > 0);
+    RX_ASSERT(bound <= 0xFFFFFFFFu);
+
+    /* Reject the values that would bias the modulo towards the low end. */
+    threshold = ((0xFFFFFFFFu - (rx_uint32)bound) + 1u) % (rx_uint32)bound;
+
+    for (;;) {
+        rx_uint32 x;
+
+        x = rxp_random_next(state);
+        if (x >= threshold) {
+            return (size_t)(x % (rx_uint32)bound);
+        }
+    }
+}
+
+static void
+rxp_shuffle_test_cases(struct rx_test_case *test_cases,
+                       size_t test_case_count,
+                       rx_uint32 seed)
+{
+    rx_uint32 state;
+    size_t i;
+
+    RX_ASSERT(test_cases != NULL);
+
+    /* Fisher-Yates shuffle. */
+    state = seed;
+    for (i = test_case_count; i > 1; --i) {
+        struct rx_test_case tmp;
+        size_t j;
+
+        j = rxp_random_below(&state, i);
+        tmp = test_cases[i - 1];
+        test_cases[i - 1] = test_cases[j];
+        test_cases[j] = tmp;
+    }
+}
+
+static int
+rxp_compare_indices(const void *a, const void *b)
+{
+    size_t aa;
+    size_t bb;
+
+    aa = *(const size_t *)a;
+    bb = *(const size_t *)b;
+    return aa < bb ? -1 : aa > bb;
+}
+
+static enum rx_status
+rxp_shard_test_cases(struct rx_test_case *selection,
+                     size_t *test_case_count,
+                     const struct rx_test_case *test_cases,
+                     const struct rxp_options *options)
+{
+    enum rx_status status;
+    struct rxp_records timings;
+    rx_uint64 *estimates;
+    struct rxp_scheduler scheduler;
+    const struct rxp_scheduler_queue *queue;
+    size_t count;
+    size_t i;
+
+    RX_ASSERT(selection != NULL);
+    RX_ASSERT(test_case_count != NULL);
+    RX_ASSERT(*test_case_count > 0);
+    RX_ASSERT(test_cases != NULL);
+    RX_ASSERT(options != NULL);
+    RX_ASSERT(options->shard_index < options->shard_count);
+
+    count = 0;
+    memset(&timings, 0, sizeof timings);
+
+    /*
+       Shards can only agree on a distribution balanced by duration if they
+       all read the exact same timings, which can't be guaranteed for a file
+       that is rewritten by each run.
+    */
+    if (options->shard_timing_path != NULL && options->timing_path != NULL
+        && strcmp(options->shard_timing_path, options->timing_path) == 0) {
+        RXP_LOG_WARNING_1("not balancing the shards with `%s` since it is "
+                          "also the timing file being written\n",
+                          options->shard_timing_path);
+    } else if (options->shard_timing_path != NULL) {
+        status = rxp_records_load(&timings, options->shard_timing_path);
+        if (status != RX_SUCCESS) {
+            return status;
+        }
+    }
+
+    if (timings.count == 0) {
+        rxp_records_destroy(&timings);
+
+        for (i = 0; i < *test_case_count; ++i) {
+            if (rxp_test_case_hash(&test_cases[i]) % options->shard_count
+                == options->shard_index) {
+                selection[count++] = test_cases[i];
+            }
+        }
+
+        *test_case_count = count;
+        return RX_SUCCESS;
+    }
+
+    estimates = (rx_uint64 *)RX_MALLOC(sizeof *estimates * *test_case_count);
+    if (estimates == NULL) {
+        RXP_LOG_ERROR("failed to allocate the estimated durations\n");
+        status = RX_ERROR_ALLOCATION;
+        goto timings_cleanup;
+    }
+
+    rxp_estimate_durations(estimates, &timings, *test_case_count, test_cases);
+
+    /*
+       Balance the total duration of each shard by assigning the test cases
+       longest-first to the least loaded shard, the same way that they are
+       distributed across the workers.
+    */
+    status = rxp_scheduler_create(
+        &scheduler, options->shard_count, *test_case_count);
+    if (status != RX_SUCCESS) {
+        goto estimates_cleanup;
+    }
+
+    rxp_scheduler_assign(&scheduler, estimates, 0, *test_case_count);
+
+    /* Preserve the order of the test cases within the shard. */
+    queue = &scheduler.queues[options->shard_index];
+    qsort(&scheduler.tasks[queue->begin],
+          queue->end - queue->begin,
+          sizeof *scheduler.tasks,
+          rxp_compare_indices);
+
+    for (i = queue->begin; i < queue->end; ++i) {
+        selection[count++] = test_cases[scheduler.tasks[i]];
+    }
+
+    rxp_scheduler_destroy(&scheduler);
+
+    *test_case_count = count;
+    status = RX_SUCCESS;
+
+estimates_cleanup:
+    RX_FREE(estimates);
+
+timings_cleanup:
+    rxp_records_destroy(&timings);
+
+    return status;
+}
+
+static enum rx_status
+rxp_run_test_cases_serially(struct rx_summary *summaries,
+                            size_t test_case_count,
+                            const struct rx_test_case *test_cases,
+                            struct rxp_watchdog *watchdog,
+                            struct rxp_data_pool *data_pool,
+                            const struct rxp_options *options)
+{
+    size_t i;
+    size_t done;
+    size_t failed_count;
+    int cancelled;
+
+    failed_count = 0;
+    cancelled = RXP_FALSE;
+
+    i = 0;
+    while (i < test_case_count && !cancelled) {
+        enum rx_status status;
+        size_t end;
+
+#if RXP_HAS_FORK
+        if (options->isolation_batch_size > 1) {
+            size_t batch_size;
+
+            batch_size = test_case_count - i;
+            if (batch_size > options->isolation_batch_size) {
+                batch_size = options->isolation_batch_size;
+            }
+
+            status = rxp_test_cases_run_isolated(&done,
+                                                 &summaries[i],
+                                                 batch_size,
+                                                 &test_cases[i],
+                                                 options);
+        } else
+#endif
+        {
+            done = 0;
+            status = rxp_test_case_execute(&summaries[i],
+                                           &test_cases[i],
+                                           rxp_watchdog_get_slot(watchdog, 0),
+                                           data_pool,
+                                           options);
+            if (status == RX_SUCCESS) {
+                done = 1;
+            }
+        }
+
+        if (status != RX_SUCCESS) {
+            RXP_LOG_ERROR_2("failed to run a test case "
+                            "(suite: \"%s\", case: \"%s\")\n",
+                            test_cases[i + done].suite_name,
+                            test_cases[i + done].name);
+            return status;
+        }
+
+        /* Print a whole batch even if the failure budget runs out midway. */
+        for (end = i + done; i < end; ++i) {
+            rxp_summary_report(&summaries[i], options);
+
+            if (rxp_failure_budget_consume(&failed_count,
+                                           &summaries[i],
+                                           options->max_failure_count)) {
+                cancelled = RXP_TRUE;
+            }
+        }
+    }
+
+    if (cancelled) {
+        rxp_failure_budget_skip_pending(summaries, NULL, i, test_case_count);
+        return RX_ERROR_CANCELLED;
+    }
+
+    return RX_SUCCESS;
+}
+
+static enum rx_status
+rxp_run_test_cases_in_runner(struct rx_summary *summaries,
+                             size_t test_case_count,
+                             const struct rx_test_case *test_cases,
+                             const rx_uint64 *estimates,
+                             const struct rxp_options *options)
+{
+    enum rx_status status;
+    struct rxp_watchdog *watchdog;
+    struct rxp_data_pool data_pool;
+#if RXP_HAS_THREADS
+    struct rxp_watchdog watchdog_instance;
+#endif
+
+    RX_ASSERT(options != NULL);
+
+    watchdog = NULL;
+    rxp_data_pool_initialize(&data_pool);
+
+    if (options->thread_count > 1
+        && rxp_test_cases_have_guard_pages(test_case_count, test_cases)) {
+        RXP_LOG_WARNING("test cases using guard pages are run within the "
+                        "runner's process, where an out-of-bounds access "
+                        "aborts the whole run (hint: use `--jobs`)\n");
+    }
+
+#if RXP_HAS_THREADS
+    /* Test cases are otherwise timed out by killing their process. */
+    if (!RXP_HAS_FORK
+        && rxp_test_cases_have_timeouts(
+            test_case_count, test_cases, options)) {
+        /* One slot per worker thread, plus one for the main thread. */
+        status = rxp_watchdog_start(&watchdog_instance,
+                                    options->thread_count + 1);
+        if (status != RX_SUCCESS) {
+            goto data_pool_cleanup;
+        }
+
+        watchdog = &watchdog_instance;
+    }
+
+    if (options->thread_count > 1) {
+        status = rxp_run_test_cases_in_threads(summaries,
+                                               test_case_count,
+                                               test_cases,
+                                               estimates,
+                                               watchdog,
+                                               &data_pool,
+                                               options);
+    } else {
+        status = rxp_run_test_cases_serially(summaries,
+                                             test_case_count,
+                                             test_cases,
+                                             watchdog,
+                                             &data_pool,
+                                             options);
+    }
+
+    if (watchdog != NULL) {
+        rxp_watchdog_stop(watchdog);
+    }
+#else
+    RXP_UNUSED(estimates);
+
+    if (rxp_test_cases_have_timeouts(test_case_count, test_cases, options)) {
+        RXP_LOG_WARNING("test cases running past their timeout cannot be "
+                        "stopped on this platform\n");
+    }
+
+    if (options->thread_count > 1) {
+        RXP_LOG_WARNING("worker threads are not supported on this "
+                        "platform, running the test cases serially\n");
+    }
+
+    status = rxp_run_test_cases_serially(summaries,
+                                         test_case_count,
+                                         test_cases,
+                                         watchdog,
+                                         &data_pool,
+                                         options);
+#endif
+
+#if RXP_HAS_THREADS
+data_pool_cleanup:
+#endif
+    rxp_data_pool_terminate(&data_pool);
+    return status;
+}
+
+static enum rx_status
+rxp_run_test_cases_once(struct rx_summary *summaries,
+                        size_t test_case_count,
+                        const struct rx_test_case *test_cases,
+                        const rx_uint64 *estimates,
+                        const struct rxp_options *options)
+{
+    RX_ASSERT(options != NULL);
+
+    if (options->job_count > 1) {
+#if RXP_HAS_FORK
+        if (options->thread_count > 1) {
+            RXP_LOG_WARNING("worker threads cannot be combined with worker "
+                            "processes, ignoring the threads\n");
+        }
+
+        return rxp_run_test_cases_in_processes(
+            summaries, test_case_count, test_cases, estimates, options);
+#else
+        RXP_LOG_WARNING("worker processes are not supported on this "
+                        "platform, running the test cases serially\n");
+#endif
+    }
+
+    return rxp_run_test_cases_in_runner(
+        summaries, test_case_count, test_cases, estimates, options);
+}
+
+static enum rx_status
+rxp_run_selected_test_cases(size_t test_case_count,
+                            const struct rx_test_case *test_cases,
+                            const rx_uint64 *estimates,
+                            struct rxp_records *timings,
+                            const struct rxp_cache *cache,
+                            struct rxp_records *last_run,
+                            const struct rxp_options *options)
+{
+    size_t i;
+    enum rx_status status;
+    struct rx_summary *summaries;
+    struct rxp_repeat_stats *stats;
+    size_t pass_count;
+    size_t pass;
+    int aborted;
+    int cancelled;
+
+    RX_ASSERT(test_case_count > 0);
+    RX_ASSERT(test_cases != NULL);
+    RX_ASSERT(timings != NULL);
+    RX_ASSERT(options != NULL);
+
+    summaries = (struct rx_summary *)RX_MALLOC(sizeof *summaries
+                                               * test_case_count);
+    if (summaries == NULL) {
+        RXP_LOG_DEBUG("failed to allocate the summaries\n");
+        return RX_ERROR_ALLOCATION;
+    }
+
+    status = RX_SUCCESS;
+
+    for (i = 0; i < test_case_count;) {
+        const struct rx_test_case *test_case;
+
+        test_case = &test_cases[i];
+
+        RX_ASSERT(test_case->suite_name != NULL);
+        RX_ASSERT(test_case->name != NULL);
+
+        status = rx_summary_initialize(&summaries[i], test_case);
+        if (status != RX_SUCCESS) {
+            RXP_LOG_ERROR_2("failed to initialize the summary "
+                            "(suite: \"%s\", case: \"%s\")\n",
+                            test_case->suite_name,
+                            test_case->name);
+            goto summaries_cleanup;
+        }
+
+        ++i;
+    }
+
+    pass_count = rxp_options_get_pass_count(options);
+    stats = NULL;
+    if (pass_count > 1) {
+        stats = (struct rxp_repeat_stats *)RX_MALLOC(sizeof *stats
+                                                     * test_case_count);
+        if (stats == NULL) {
+            RXP_LOG_ERROR("failed to allocate the repetition statistics\n");
+            status = RX_ERROR_ALLOCATION;
+            goto summaries_cleanup;
+        }
+
+        memset(stats, 0, sizeof *stats * test_case_count);
+    }
+
+    status = rxp_shared_fixtures_create(
+        &rxp_shared_fixtures_instance, test_case_count, test_cases);
+    if (status != RX_SUCCESS) {
+        goto shared_fixtures_cleanup;
+    }
+
+    aborted = RXP_FALSE;
+
+    for (pass = 0; pass < pass_count; ++pass) {
+        size_t j;
+        int failed;
+
+        /* Reuse the summaries and their storage across the passes. */
+        if (pass > 0) {
+            for (j = 0; j < test_case_count; ++j) {
+                rxp_summary_reset(&summaries[j]);
+            }
+        }
+
+        rxp_shared_fixtures_rewind(&rxp_shared_fixtures_instance);
+        status = rxp_run_test_cases_once(
+            summaries, test_case_count, test_cases, estimates, options);
+        rxp_shared_fixtures_tear_down(&rxp_shared_fixtures_instance);
+        if (status != RX_SUCCESS && status != RX_ERROR_CANCELLED) {
+            break;
+        }
+
+        failed = RXP_FALSE;
+        for (j = 0; j < test_case_count; ++j) {
+            size_t k;
+            const struct rx_summary *summary;
+
+            summary = &summaries[j];
+            failed |= summary->failure_count > 0;
+
+            for (k = 0; k < summary->failure_count; ++k) {
+                aborted |= summary->failures[k].severity == RX_FATAL;
+            }
+
+            if (stats != NULL) {
+                rxp_repeat_stats_add(&stats[j], summary);
+            }
+        }
+
+        if (status == RX_ERROR_CANCELLED) {
+            break;
+        }
+
+        if (failed && options->until_fail) {
+            RXP_LOG_INFO_1("the test cases failed on pass %lu\n",
+                           (unsigned long)(pass + 1));
+            break;
+        }
+    }
+
+    if (stats != NULL) {
+        rxp_repeat_stats_print(stats, summaries, test_case_count);
+    }
+
+    /* Persist the results of the test cases that completed before the run
+       got cancelled. */
+    cancelled = status == RX_ERROR_CANCELLED;
+    if (cancelled) {
+        RXP_LOG_INFO("the run was cancelled after reaching the maximum "
+                     "number of failures\n");
+        status = RX_SUCCESS;
+    }
+
+    if (status == RX_SUCCESS && options->timing_path != NULL) {
+        status = rxp_timings_save(
+            timings, options->timing_path, summaries, test_case_count);
+    }
+
+    if (status == RX_SUCCESS && last_run != NULL) {
+        status = rxp_last_run_save(last_run,
+                                   options->last_run_path,
+                                   summaries,
+                                   stats,
+                                   test_case_count);
+    }
+
+    if (status == RX_SUCCESS && cache != NULL) {
+        status = rxp_cache_save(
+            cache, options->cache_path, summaries, stats, test_case_count);
+    }
+
+    if (status == RX_SUCCESS && cancelled) {
+        status = RX_ERROR_CANCELLED;
+    } else if (status == RX_SUCCESS && aborted) {
+        status = RX_ERROR_ABORTED;
+    }
+
+shared_fixtures_cleanup:
+    rxp_shared_fixtures_destroy(&rxp_shared_fixtures_instance);
+    RX_FREE(stats);
+
+summaries_cleanup:
+    while (i-- > 0) {
+        rx_summary_terminate(&summaries[i]);
+    }
+
+    RX_FREE(summaries);
+
+    return status;
+}
+
+RXP_MAYBE_UNUSED static enum rx_status
+rxp_run_test_cases(size_t test_case_count,
+                   const struct rx_test_case *test_cases,
+                   const struct rxp_options *options)
+{
+    enum rx_status status;
+    struct rxp_records timings;
+    struct rxp_cache cache_instance;
+    struct rxp_cache *cache;
+    struct rxp_records last_run_instance;
+    struct rxp_records *last_run;
+    rx_uint64 *estimates;
+    struct rx_test_case *selection;
+
+    RX_ASSERT(options != NULL);
+
+    if (test_case_count == 0) {
+        RXP_LOG_INFO("nothing to run\n");
+        return RX_SUCCESS;
+    }
+
+    RX_ASSERT(test_cases != NULL);
+
+    memset(&timings, 0, sizeof timings);
+    cache = NULL;
+    last_run = NULL;
+    estimates = NULL;
+    selection = NULL;
+
+    if (options->timing_path != NULL) {
+        status = rxp_records_load(&timings, options->timing_path);
+        if (status != RX_SUCCESS) {
+            return status;
+        }
+
+        estimates = (rx_uint64 *)RX_MALLOC(sizeof *estimates
+                                           * test_case_count);
+        if (estimates == NULL) {
+            RXP_LOG_ERROR("failed to allocate the estimated durations\n");
+            status = RX_ERROR_ALLOCATION;
+            goto timings_cleanup;
+        }
+
+        rxp_estimate_durations(
+            estimates, &timings, test_case_count, test_cases);
+    }
+
+    /*
+       Select the test cases to run before allocating anything else for them,
+       so that the ones being left out don't cost anything.
+    */
+    if (options->shard_count > 1) {
+        selection = (struct rx_test_case *)RX_MALLOC(sizeof *selection
+                                                     * test_case_count);
+        if (selection == NULL) {
+            RXP_LOG_ERROR("failed to allocate the selected test cases\n");
+            status = RX_ERROR_ALLOCATION;
+            goto estimates_cleanup;
+        }
+
+        status = rxp_shard_test_cases(
+            selection, &test_case_count, test_cases, options);
+        if (status != RX_SUCCESS) {
+            goto selection_cleanup;
+        }
+
+        test_cases = selection;
+    }
+
+    /* Copy the test cases for them to be reordered or compacted in place. */
+    if ((options->shuffle || options->failed_first || options->last_failed
+         || options->cache_path != NULL)
+        && selection == NULL && test_case_count > 0) {
+        selection = (struct rx_test_case *)RX_MALLOC(sizeof *selection
+                                                     * test_case_count);
+        if (selection == NULL) {
+            RXP_LOG_ERROR("failed to allocate the selected test cases\n");
+            status = RX_ERROR_ALLOCATION;
+            goto estimates_cleanup;
+        }
+
+        memcpy(selection, test_cases, sizeof *selection * test_case_count);
+        test_cases = selection;
+    }
+
+    /*
+       Shuffle after sharding, so that all the shards agree on the test cases
+       that they each run, whatever the seed.
+    */
+    if (options->shuffle && test_case_count > 0) {
+        rx_uint32 seed;
+
+        seed = options->seed;
+        if (!options->has_seed) {
+            uint64_t time;
+
+            if (rxp_get_real_time(&time) != RX_SUCCESS) {
+                time = 0;
+            }
+
+            seed = (rx_uint32)((time ^ (time >> 32)) & 0xFFFFFFFFu);
+        }
+
+        /* Report the seed for the order to be replayed with `--seed`. */
+        RXP_LOCK_FILE(stderr);
+        fprintf(stderr, "[SHUFFLE] seed: %lu\n", (unsigned long)seed);
+        RXP_UNLOCK_FILE(stderr);
+
+        rxp_shuffle_test_cases(selection, test_case_count, seed);
+    }
+
+    if (options->last_run_path != NULL && test_case_count > 0) {
+        status = rxp_records_load(&last_run_instance, options->last_run_path);
+        if (status != RX_SUCCESS) {
+            goto selection_cleanup;
+        }
+
+        last_run = &last_run_instance;
+    }
+
+    if (last_run != NULL && (options->failed_first || options->last_failed)) {
+        status = rxp_last_run_select(
+            last_run, &test_case_count, selection, options);
+        if (status != RX_SUCCESS) {
+            goto last_run_cleanup;
+        }
+    }
+
+    if (options->cache_path != NULL && test_case_count > 0) {
+        status = rxp_cache_load(&cache_instance, options->cache_path);
+        if (status != RX_SUCCESS) {
+            goto last_run_cleanup;
+        }
+
+        cache = &cache_instance;
+
+        status = rxp_cache_select(cache, &test_case_count, selection, options);
+        if (status != RX_SUCCESS) {
+            goto cache_cleanup;
+        }
+    }
+
+    if (selection != NULL && estimates != NULL) {
+        rxp_estimate_durations(
+            estimates, &timings, test_case_count, test_cases);
+    }
+
+    if (test_case_count == 0) {
+        RXP_LOG_INFO("nothing to run\n");
+        status = RX_SUCCESS;
+        goto cache_cleanup;
+    }
+
+    status = rxp_run_selected_test_cases(test_case_count,
+                                         test_cases,
+                                         estimates,
+                                         &timings,
+                                         cache,
+                                         last_run,
+                                         options);
+
+    /*
+       The session fixtures and the snapshots last for the whole run, across
+       all the passes.
+    */
+    rxp_session_fixtures_tear_down(test_case_count, test_cases);
+    rxp_snapshots_destroy(&rxp_snapshots_instance);
+
+cache_cleanup:
+    if (cache != NULL) {
+        rxp_cache_destroy(cache);
+    }
+
+last_run_cleanup:
+    if (last_run != NULL) {
+        rxp_records_destroy(last_run);
+    }
+
+selection_cleanup:
+    RX_FREE(selection);
+
+estimates_cleanup:
+    RX_FREE(estimates);
+
+timings_cleanup:
+    rxp_records_destroy(&timings);
+
+    return status;
+}
+
+RXP_MAYBE_UNUSED static enum rx_status
+rxp_run_registered_test_cases(const struct rxp_options *options)
+{
+    enum rx_status out;
+    rx_size test_case_count;
+    struct rx_test_case *test_cases;
+
+    out = rxp_enumerate_test_cases(&test_case_count, NULL, &options->filter);
+    if (out != RX_SUCCESS) {
+        return out;
+    }
+
+    if (test_case_count == 0) {
+        return rxp_run_test_cases(0, NULL, options);
+    }
+
+    test_cases = (struct rx_test_case *)RX_MALLOC(sizeof *test_cases
+                                                  * test_case_count);
+    if (test_cases == NULL) {
         RXP_LOG_ERROR("failed to allocate the test cases\n");
         return RX_ERROR_ALLOCATION;
     }
 
-    rx_enumerate_test_cases(&test_case_count, test_cases);
-    out = rxp_run_test_cases(test_case_count, test_cases);
-    RX_FREE(test_cases);
-    return out;
+    out = rxp_enumerate_test_cases(
+        &test_case_count, test_cases, &options->filter);
+    if (out == RX_SUCCESS) {
+        out = rxp_run_test_cases(test_case_count, test_cases, options);
+    }
+
+    RX_FREE(test_cases);
+    return out;
+}
+
+static enum rx_status
+rxp_run_filtered_test_cases(size_t test_case_count,
+                            const struct rx_test_case *test_cases,
+                            const struct rxp_options *options)
+{
+    enum rx_status out;
+    struct rx_test_case *selection;
+    size_t selection_count;
+    size_t i;
+
+    RX_ASSERT(options != NULL);
+
+    if (test_case_count == 0) {
+        return rxp_run_test_cases(0, NULL, options);
+    }
+
+    selection = (struct rx_test_case *)RX_MALLOC(sizeof *selection
+                                                  * test_case_count);
+    if (selection == NULL) {
+        RXP_LOG_ERROR("failed to allocate the selected test cases\n");
+        return RX_ERROR_ALLOCATION;
+    }
+
+    selection_count = 0;
+    for (i = 0; i < test_case_count; ++i) {
+        int matched;
+
+        out = rxp_filter_match(&matched,
+                               &options->filter,
+                               test_cases[i].suite_name,
+                               test_cases[i].name);
+        if (out != RX_SUCCESS) {
+            goto selection_cleanup;
+        }
+
+        if (matched) {
+            selection[selection_count++] = test_cases[i];
+        }
+    }
+
+    out = rxp_run_test_cases(selection_count, selection, options);
+
+selection_cleanup:
+    RX_FREE(selection);
+    return out;
+}
+
+static enum rx_status
+rxp_run(rx_size test_case_count,
+        const struct rx_test_case *test_cases,
+        const struct rxp_options *options)
+{
+    /* A clock that can't be used is not worth failing the run for. */
+    if (rxp_clock_select(&rxp_clock_instance, options->clock) != RX_SUCCESS) {
+        RXP_LOG_WARNING_1("falling back to the `%s` clock\n",
+                          rxp_clock_get_name(RXP_CLOCK_DEFAULT));
+    }
+
+    /* Report the clock whenever its precision matters. */
+    if (options->clock != RXP_CLOCK_DEFAULT || options->benchmark) {
+        double resolution;
+        double overhead;
+
+        if (rxp_clock_measure(&resolution, &overhead) == RX_SUCCESS) {
+            RXP_LOCK_FILE(stderr);
+            fprintf(stderr,
+                    "[CLOCK] %s (resolution: %.1f ns, overhead: %.1f ns)\n",
+                    rxp_clock_get_name(rxp_clock_instance.kind),
+                    resolution,
+                    overhead);
+            RXP_UNLOCK_FILE(stderr);
+        }
+    }
+
+    rxp_settings_instance.property_run_count
+        = options->property_run_count > 0 ? options->property_run_count
+                                          : RXP_PROPERTY_DEFAULT_RUN_COUNT;
+    rxp_settings_instance.property_seed = options->property_seed;
+    if (!options->has_property_seed) {
+        uint64_t time;
+
+        if (rxp_get_real_time(&time) != RX_SUCCESS) {
+            time = 0;
+        }
+
+        rxp_settings_instance.property_seed
+            = (rx_uint32)((time ^ (time >> 32)) & 0xFFFFFFFFu);
+    }
+
+    rxp_settings_instance.corpus_path = options->corpus_path;
+
+    rxp_settings_instance.benchmark = options->benchmark;
+    rxp_settings_instance.benchmark_min_time_ms
+        = options->benchmark_min_time_ms > 0
+              ? options->benchmark_min_time_ms
+              : RXP_BENCHMARK_DEFAULT_MIN_TIME_MS;
+    rxp_settings_instance.benchmark_sample_count
+        = options->benchmark_sample_count > 0
+              ? options->benchmark_sample_count
+              : RXP_BENCHMARK_DEFAULT_SAMPLE_COUNT;
+
+    if (test_cases != NULL) {
+        if (options->filter.count > 0) {
+            return rxp_run_filtered_test_cases(
+                test_case_count, test_cases, options);
+        }
+
+        return rxp_run_test_cases(test_case_count, test_cases, options);
+    }
+
+    /* If no test cases are explicitly passed, fallback to discovering the
+       ones defined through the automatic registration framework. */
+    return rxp_run_registered_test_cases(options);
+}
+
+/* Implementation: List                                            O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   Listing the test cases streams their names straight from the registration
+   section, without allocating, sorting, or building their config, meaning
+   that they are listed in an unspecified order.
+*/
+
+static void
+rxp_list_write_json_str(FILE *file, const char *s)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    RX_ASSERT(file != NULL);
+    RX_ASSERT(s != NULL);
+
+    putc('"', file);
+    for (; *s != '\0'; ++s) {
+        unsigned char c;
+
+        c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            putc('\\', file);
+            putc(c, file);
+        } else if (c < 0x20) {
+            fputs("\\u00", file);
+            putc(hex[c >> 4], file);
+            putc(hex[c & 0x0F], file);
+        } else {
+            putc(c, file);
+        }
+    }
+
+    putc('"', file);
+}
+
+static void
+rxp_list_write(FILE *file,
+               enum rxp_list_format format,
+               const char *suite_name,
+               const char *name)
+{
+    RX_ASSERT(file != NULL);
+    RX_ASSERT(suite_name != NULL);
+    RX_ASSERT(name != NULL);
+
+    switch (format) {
+        case RXP_LIST_FORMAT_JSON:
+            fputs("{\"suite\": ", file);
+            rxp_list_write_json_str(file, suite_name);
+            fputs(", \"name\": ", file);
+            rxp_list_write_json_str(file, name);
+            fputs("}\n", file);
+            return;
+        case RXP_LIST_FORMAT_PLAIN:
+        case RXP_LIST_FORMAT_NONE:
+        default:
+            fputs(suite_name, file);
+            putc('/', file);
+            fputs(name, file);
+            putc('\n', file);
+            return;
+    }
+}
+
+static enum rx_status
+rxp_list_test_cases(rx_size test_case_count,
+                    const struct rx_test_case *test_cases,
+                    const struct rxp_options *options)
+{
+    enum rx_status status;
+    int matched;
+
+    RX_ASSERT(options != NULL);
+    RX_ASSERT(options->list_format != RXP_LIST_FORMAT_NONE);
+
+    if (test_cases != NULL) {
+        size_t i;
+
+        for (i = 0; i < test_case_count; ++i) {
+            matched = RXP_TRUE;
+            if (options->filter.count > 0) {
+                status = rxp_filter_match(&matched,
+                                          &options->filter,
+                                          test_cases[i].suite_name,
+                                          test_cases[i].name);
+                if (status != RX_SUCCESS) {
+                    return status;
+                }
+            }
+
+            if (matched) {
+                rxp_list_write(stdout,
+                               options->list_format,
+                               test_cases[i].suite_name,
+                               test_cases[i].name);
+            }
+        }
+    } else {
+#if RXP_TEST_DISCOVERY
+        const struct rxp_test_case_desc * const *c_it;
+        rx_size row;
+
+        for (c_it = RXP_TEST_CASE_SECTION_BEGIN;
+             c_it != RXP_TEST_CASE_SECTION_END;
+             ++c_it) {
+            for (row = 0; row < rxp_test_case_desc_get_row_count(*c_it);
+                 ++row) {
+                status = rxp_test_case_desc_match(
+                    &matched, *c_it, row, &options->filter);
+                if (status != RX_SUCCESS) {
+                    return status;
+                }
+
+                if (matched) {
+                    rxp_list_write(stdout,
+                                   options->list_format,
+                                   (*c_it)->suite_name,
+                                   rxp_test_case_desc_get_name(*c_it, row));
+                }
+            }
+        }
+#endif
+    }
+
+    if (fflush(stdout) != 0 || ferror(stdout)) {
+        RXP_LOG_ERROR("failed to write the list of test cases\n");
+        return RX_ERROR;
+    }
+
+    return RX_SUCCESS;
+}
+
+/* Implementation: Test Assessments                                O-(''Q)
+   -------------------------------------------------------------------------- */
+
+RXP_PRINTF_CHECK(8, 0)
+RXP_MAYBE_UNUSED static void
+rxp_assess_value(struct rx_context *context,
+                 int x,
+                 int expected,
+                 const char *expr,
+                 const char *file,
+                 int line,
+                 enum rx_severity severity,
+                 const char *failure_fmt,
+                 ...)
+{
+    int result;
+    char *failure_msg;
+    char *diagnostic_msg;
+
+    RX_ASSERT(context != NULL);
+    RX_ASSERT(file != NULL);
+
+    result = ((x && expected) || (!x && !expected));
+
+    if (result) {
+        failure_msg = NULL;
+        diagnostic_msg = NULL;
+    } else {
+        enum rx_status status;
+
+        if (failure_fmt == NULL) {
+            RXP_STR_CREATE_1(status,
+                             failure_msg,
+                             "`%s` is expected to evaluate to true",
+                             expr);
+        } else {
+            RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
+        }
+
+        if (status != RX_SUCCESS) {
+            RXP_LOG_DEBUG_2("failed to create the failure message for "
+                            "the test located at %s:%d\n",
+                            file,
+                            line);
+            failure_msg = NULL;
+        }
+
+        RXP_STR_CREATE_1(status, diagnostic_msg, "%d", x);
+        if (status != RX_SUCCESS) {
+            RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
+                            "the test located at %s:%d\n",
+                            file,
+                            line);
+            diagnostic_msg = NULL;
+        }
+    }
+
+    if (rx_handle_test_result(
+            context, result, file, line, severity, failure_msg, diagnostic_msg)
+        != RX_SUCCESS) {
+        RXP_LOG_DEBUG_2("failed to handle the test result for the test "
+                        "located at %s:%d\n",
+                        file,
+                        line);
+    }
+
+    RX_FREE(failure_msg);
+    RX_FREE(diagnostic_msg);
+
+    if (!result && severity == RX_FATAL) {
+        rx_abort(context);
+    }
+}
+
+RXP_PRINTF_CHECK(8, 0)
+RXP_MAYBE_UNUSED static void
+rxp_bool_assess_value(struct rx_context *context,
+                      int x,
+                      int expected,
+                      const char *expr,
+                      const char *file,
+                      int line,
+                      enum rx_severity severity,
+                      const char *failure_fmt,
+                      ...)
+{
+    int result;
+    char *failure_msg;
+    char *diagnostic_msg;
+
+    RX_ASSERT(context != NULL);
+    RX_ASSERT(expr != NULL);
+    RX_ASSERT(file != NULL);
+
+    result = ((x && expected) || (!x && !expected));
+
+    if (result) {
+        failure_msg = NULL;
+        diagnostic_msg = NULL;
+    } else {
+        enum rx_status status;
+
+        if (failure_fmt == NULL) {
+            RXP_STR_CREATE_2(status,
+                             failure_msg,
+                             "`%s` is expected to be %s",
+                             expr,
+                             expected ? "true" : "false");
+        } else {
+            RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
+        }
+
+        if (status != RX_SUCCESS) {
+            RXP_LOG_DEBUG_2("failed to create the failure message for "
+                            "the boolean test located at %s:%d\n",
+                            file,
+                            line);
+            failure_msg = NULL;
+        }
+
+        RXP_STR_CREATE_2(status, diagnostic_msg, "%d == %d", x, expected);
+        if (status != RX_SUCCESS) {
+            RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
+                            "the boolean test located at %s:%d\n",
+                            file,
+                            line);
+            diagnostic_msg = NULL;
+        }
+    }
+
+    if (rx_handle_test_result(
+            context, result, file, line, severity, failure_msg, diagnostic_msg)
+        != RX_SUCCESS) {
+        RXP_LOG_DEBUG_2("failed to handle the test result for the boolean test "
+                        "located at %s:%d\n",
+                        file,
+                        line);
+    }
+
+    RX_FREE(failure_msg);
+    RX_FREE(diagnostic_msg);
+
+    if (!result && severity == RX_FATAL) {
+        rx_abort(context);
+    }
+}
+
+RXP_PRINTF_CHECK(10, 0)
+RXP_MAYBE_UNUSED static void
+rxp_int_assess_comparison(struct rx_context *context,
+                          rxp_int x1,
+                          rxp_int x2,
+                          enum rxp_op op,
+                          const char *expr1,
+                          const char *expr2,
+                          const char *file,
+                          int line,
+                          enum rx_severity severity,
+                          const char *failure_fmt,
+                          ...)
+{
+    int result;
+    char *failure_msg;
+    char *diagnostic_msg;
+
+    RX_ASSERT(context != NULL);
+    RX_ASSERT(expr1 != NULL);
+    RX_ASSERT(expr2 != NULL);
+    RX_ASSERT(file != NULL);
+
+    switch (op) {
+        case RXP_OP_EQUAL:
+            result = x1 == x2;
+            break;
+        case RXP_OP_NOT_EQUAL:
+            result = x1 != x2;
+            break;
+        case RXP_OP_GREATER:
+            result = x1 > x2;
+            break;
+        case RXP_OP_LESSER:
+            result = x1 < x2;
+            break;
+        case RXP_OP_GREATER_OR_EQUAL:
+            result = x1 >= x2;
+            break;
+        case RXP_OP_LESSER_OR_EQUAL:
+            result = x1 <= x2;
+            break;
+        default:
+            RX_ASSERT(0);
+            result = 0;
+            break;
+    }
+
+    if (result) {
+        failure_msg = NULL;
+        diagnostic_msg = NULL;
+    } else {
+        enum rx_status status;
+        const char *op_symbol;
+
+        if (failure_fmt == NULL) {
+            const char *op_name;
+
+            rxp_op_get_name(&op_name, op);
+            RXP_STR_CREATE_3(status,
+                             failure_msg,
+                             "`%s` is expected to be %s `%s`",
+                             expr1,
+                             op_name,
+                             expr2);
+        } else {
+            RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
+        }
+
+        if (status != RX_SUCCESS) {
+            RXP_LOG_DEBUG_2("failed to create the failure message for "
+                            "the integer comparison test located at %s:%d\n",
+                            file,
+                            line);
+            failure_msg = NULL;
+        }
+
+        rxp_op_get_symbol(&op_symbol, op);
+        RXP_STR_CREATE_3(status,
+                         diagnostic_msg,
+                         "%ld %s %ld",
+                         (long)x1,
+                         op_symbol,
+                         (long)x2);
+        if (status != RX_SUCCESS) {
+            RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
+                            "the integer comparison test located at %s:%d\n",
+                            file,
+                            line);
+            diagnostic_msg = NULL;
+        }
+    }
+
+    if (rx_handle_test_result(
+            context, result, file, line, severity, failure_msg, diagnostic_msg)
+        != RX_SUCCESS) {
+        RXP_LOG_DEBUG_2("failed to handle the test result for the integer "
+                        "comparison test located at %s:%d\n",
+                        file,
+                        line);
+    }
+
+    RX_FREE(failure_msg);
+    RX_FREE(diagnostic_msg);
+
+    if (!result && severity == RX_FATAL) {
+        rx_abort(context);
+    }
 }
 
-/* Implementation: Test Assessments                                O-(''Q)
-   -------------------------------------------------------------------------- */
+RXP_PRINTF_CHECK(10, 0)
+RXP_MAYBE_UNUSED static void
+rxp_uint_assess_comparison(struct rx_context *context,
+                           rxp_uint x1,
+                           rxp_uint x2,
+                           enum rxp_op op,
+                           const char *expr1,
+                           const char *expr2,
+                           const char *file,
+                           int line,
+                           enum rx_severity severity,
+                           const char *failure_fmt,
+                           ...)
+{
+    int result;
+    char *failure_msg;
+    char *diagnostic_msg;
 
-RXP_PRINTF_CHECK(8, 0)
+    RX_ASSERT(context != NULL);
+    RX_ASSERT(expr1 != NULL);
+    RX_ASSERT(expr2 != NULL);
+    RX_ASSERT(file != NULL);
+
+    switch (op) {
+        case RXP_OP_EQUAL:
+            result = x1 == x2;
+            break;
+        case RXP_OP_NOT_EQUAL:
+            result = x1 != x2;
+            break;
+        case RXP_OP_GREATER:
+            result = x1 > x2;
+            break;
+        case RXP_OP_LESSER:
+            result = x1 < x2;
+            break;
+        case RXP_OP_GREATER_OR_EQUAL:
+            result = x1 >= x2;
+            break;
+        case RXP_OP_LESSER_OR_EQUAL:
+            result = x1 <= x2;
+            break;
+        default:
+            RX_ASSERT(0);
+            result = 0;
+            break;
+    }
+
+    if (result) {
+        failure_msg = NULL;
+        diagnostic_msg = NULL;
+    } else {
+        enum rx_status status;
+        const char *op_symbol;
+
+        if (failure_fmt == NULL) {
+            const char *op_name;
+
+            rxp_op_get_name(&op_name, op);
+            RXP_STR_CREATE_3(status,
+                             failure_msg,
+                             "`%s` is expected to be %s `%s`",
+                             expr1,
+                             op_name,
+                             expr2);
+        } else {
+            RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
+        }
+
+        if (status != RX_SUCCESS) {
+            RXP_LOG_DEBUG_2("failed to create the failure message for "
+                            "the unsigned integer comparison test located at "
+                            "%s:%d\n",
+                            file,
+                            line);
+            failure_msg = NULL;
+        }
+
+        rxp_op_get_symbol(&op_symbol, op);
+        RXP_STR_CREATE_3(status,
+                         diagnostic_msg,
+                         "%lu %s %lu",
+                         (unsigned long)x1,
+                         op_symbol,
+                         (unsigned long)x2);
+        if (status != RX_SUCCESS) {
+            RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
+                            "the unsigned integer comparison test located at "
+                            "%s:%d\n",
+                            file,
+                            line);
+            diagnostic_msg = NULL;
+        }
+    }
+
+    if (rx_handle_test_result(
+            context, result, file, line, severity, failure_msg, diagnostic_msg)
+        != RX_SUCCESS) {
+        RXP_LOG_DEBUG_2("failed to handle the test result for the unsigned "
+                        "integer comparison test located at %s:%d\n",
+                        file,
+                        line);
+    }
+
+    RX_FREE(failure_msg);
+    RX_FREE(diagnostic_msg);
+
+    if (!result && severity == RX_FATAL) {
+        rx_abort(context);
+    }
+}
+
+RXP_PRINTF_CHECK(10, 0)
 RXP_MAYBE_UNUSED static void
-rxp_assess_value(struct rx_context *context,
-                 int x,
-                 int expected,
-                 const char *expr,
-                 const char *file,
-                 int line,
-                 enum rx_severity severity,
-                 const char *failure_fmt,
-                 ...)
+rxp_real_assess_comparison(struct rx_context *context,
+                           rxp_real x1,
+                           rxp_real x2,
+                           enum rxp_op op,
+                           const char *expr1,
+                           const char *expr2,
+                           const char *file,
+                           int line,
+                           enum rx_severity severity,
+                           const char *failure_fmt,
+                           ...)
 {
     int result;
     char *failure_msg;
     char *diagnostic_msg;
 
     RX_ASSERT(context != NULL);
+    RX_ASSERT(expr1 != NULL);
+    RX_ASSERT(expr2 != NULL);
     RX_ASSERT(file != NULL);
 
-    result = ((x && expected) || (!x && !expected));
+    switch (op) {
+#if defined(__GNUC__)
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+        case RXP_OP_EQUAL:
+            result = x1 == x2;
+            break;
+        case RXP_OP_NOT_EQUAL:
+            result = x1 != x2;
+            break;
+#if defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+        case RXP_OP_GREATER:
+            result = x1 > x2;
+            break;
+        case RXP_OP_LESSER:
+            result = x1 < x2;
+            break;
+        case RXP_OP_GREATER_OR_EQUAL:
+            result = x1 >= x2;
+            break;
+        case RXP_OP_LESSER_OR_EQUAL:
+            result = x1 <= x2;
+            break;
+        default:
+            RX_ASSERT(0);
+            result = 0;
+            break;
+    }
 
     if (result) {
         failure_msg = NULL;
         diagnostic_msg = NULL;
     } else {
         enum rx_status status;
+        const char *op_symbol;
 
         if (failure_fmt == NULL) {
-            RXP_STR_CREATE_1(status,
+            const char *op_name;
+
+            rxp_op_get_name(&op_name, op);
+            RXP_STR_CREATE_3(status,
                              failure_msg,
-                             "`%s` is expected to evaluate to true",
-                             expr);
+                             "`%s` is expected to be %s `%s`",
+                             expr1,
+                             op_name,
+                             expr2);
         } else {
             RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
         }
 
         if (status != RX_SUCCESS) {
             RXP_LOG_DEBUG_2("failed to create the failure message for "
-                            "the test located at %s:%d\n",
+                            "the real comparison test located at %s:%d\n",
                             file,
                             line);
             failure_msg = NULL;
         }
 
-        RXP_STR_CREATE_1(status, diagnostic_msg, "%d", x);
+        rxp_op_get_symbol(&op_symbol, op);
+        RXP_STR_CREATE_3(
+            status, diagnostic_msg, "%Lf %s %Lf", x1, op_symbol, x2);
         if (status != RX_SUCCESS) {
             RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
-                            "the test located at %s:%d\n",
+                            "the real comparison test located at %s:%d\n",
                             file,
                             line);
             diagnostic_msg = NULL;
@@ -1958,8 +9811,8 @@ rxp_assess_value(struct rx_context *context,
     if (rx_handle_test_result(
             context, result, file, line, severity, failure_msg, diagnostic_msg)
         != RX_SUCCESS) {
-        RXP_LOG_DEBUG_2("failed to handle the test result for the test "
-                        "located at %s:%d\n",
+        RXP_LOG_DEBUG_2("failed to handle the test result for the real "
+                        "comparison test located at %s:%d\n",
                         file,
                         line);
     }
@@ -1972,56 +9825,81 @@ rxp_assess_value(struct rx_context *context,
     }
 }
 
-RXP_PRINTF_CHECK(8, 0)
+RXP_PRINTF_CHECK(11, 0)
 RXP_MAYBE_UNUSED static void
-rxp_bool_assess_value(struct rx_context *context,
-                      int x,
-                      int expected,
-                      const char *expr,
-                      const char *file,
-                      int line,
-                      enum rx_severity severity,
-                      const char *failure_fmt,
-                      ...)
+rxp_real_assess_fuzzy_comparison(struct rx_context *context,
+                                 rxp_real x1,
+                                 rxp_real x2,
+                                 rxp_real tol,
+                                 enum rxp_op op,
+                                 const char *expr1,
+                                 const char *expr2,
+                                 const char *file,
+                                 int line,
+                                 enum rx_severity severity,
+                                 const char *failure_fmt,
+                                 ...)
 {
     int result;
     char *failure_msg;
     char *diagnostic_msg;
 
     RX_ASSERT(context != NULL);
-    RX_ASSERT(expr != NULL);
+    RX_ASSERT(expr1 != NULL);
+    RX_ASSERT(expr2 != NULL);
     RX_ASSERT(file != NULL);
 
-    result = ((x && expected) || (!x && !expected));
+    switch (op) {
+        case RXP_OP_EQUAL:
+            rxp_real_are_equal_fuzzy(&result, x1, x2, tol);
+            break;
+        case RXP_OP_NOT_EQUAL:
+            rxp_real_are_equal_fuzzy(&result, x1, x2, tol);
+            result = !result;
+            break;
+        default:
+            RX_ASSERT(0);
+            result = 0;
+            break;
+    }
 
     if (result) {
         failure_msg = NULL;
         diagnostic_msg = NULL;
     } else {
         enum rx_status status;
+        const char *op_symbol;
 
         if (failure_fmt == NULL) {
-            RXP_STR_CREATE_2(status,
+            const char *op_name;
+
+            rxp_op_get_name(&op_name, op);
+            RXP_STR_CREATE_4(status,
                              failure_msg,
-                             "`%s` is expected to be %s",
-                             expr,
-                             expected ? "true" : "false");
+                             "`%s` is expected to be almost %s `%s` "
+                             "(tolerance: %Lf)",
+                             expr1,
+                             op_name,
+                             expr2,
+                             tol);
         } else {
             RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
         }
 
         if (status != RX_SUCCESS) {
             RXP_LOG_DEBUG_2("failed to create the failure message for "
-                            "the boolean test located at %s:%d\n",
+                            "the real almost equal test located at %s:%d\n",
                             file,
                             line);
             failure_msg = NULL;
         }
 
-        RXP_STR_CREATE_2(status, diagnostic_msg, "%d == %d", x, expected);
+        rxp_op_get_symbol(&op_symbol, op);
+        RXP_STR_CREATE_3(
+            status, diagnostic_msg, "%Lf %s %Lf", x1, op_symbol, x2);
         if (status != RX_SUCCESS) {
             RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
-                            "the boolean test located at %s:%d\n",
+                            "the real almost equal test located at %s:%d\n",
                             file,
                             line);
             diagnostic_msg = NULL;
@@ -2031,8 +9909,8 @@ rxp_bool_assess_value(struct rx_context *context,
     if (rx_handle_test_result(
             context, result, file, line, severity, failure_msg, diagnostic_msg)
         != RX_SUCCESS) {
-        RXP_LOG_DEBUG_2("failed to handle the test result for the boolean test "
-                        "located at %s:%d\n",
+        RXP_LOG_DEBUG_2("failed to handle the test result for the real "
+                        "almost equal test located at %s:%d\n",
                         file,
                         line);
     }
@@ -2045,11 +9923,12 @@ rxp_bool_assess_value(struct rx_context *context,
     }
 }
 
-RXP_PRINTF_CHECK(10, 0)
+RXP_PRINTF_CHECK(11, 0)
 RXP_MAYBE_UNUSED static void
-rxp_int_assess_comparison(struct rx_context *context,
-                          rxp_int x1,
-                          rxp_int x2,
+rxp_str_assess_comparison(struct rx_context *context,
+                          const char *s1,
+                          const char *s2,
+                          enum rxp_str_case str_case,
                           enum rxp_op op,
                           const char *expr1,
                           const char *expr2,
@@ -2064,28 +9943,23 @@ rxp_int_assess_comparison(struct rx_context *context,
     char *diagnostic_msg;
 
     RX_ASSERT(context != NULL);
+    RX_ASSERT(s1 != NULL);
+    RX_ASSERT(s2 != NULL);
     RX_ASSERT(expr1 != NULL);
     RX_ASSERT(expr2 != NULL);
     RX_ASSERT(file != NULL);
 
     switch (op) {
         case RXP_OP_EQUAL:
-            result = x1 == x2;
+            str_case == RXP_STR_CASE_OBEY
+                ? rxp_str_are_equal(&result, s1, s2)
+                : rxp_str_are_equal_no_case(&result, s1, s2);
             break;
         case RXP_OP_NOT_EQUAL:
-            result = x1 != x2;
-            break;
-        case RXP_OP_GREATER:
-            result = x1 > x2;
-            break;
-        case RXP_OP_LESSER:
-            result = x1 < x2;
-            break;
-        case RXP_OP_GREATER_OR_EQUAL:
-            result = x1 >= x2;
-            break;
-        case RXP_OP_LESSER_OR_EQUAL:
-            result = x1 <= x2;
+            str_case == RXP_STR_CASE_OBEY
+                ? rxp_str_are_equal(&result, s1, s2)
+                : rxp_str_are_equal_no_case(&result, s1, s2);
+            result = !result;
             break;
         default:
             RX_ASSERT(0);
@@ -2101,37 +9975,36 @@ rxp_int_assess_comparison(struct rx_context *context,
         const char *op_symbol;
 
         if (failure_fmt == NULL) {
+            const char *str_case_type;
             const char *op_name;
 
+            rxp_str_case_get_type(&str_case_type, str_case);
             rxp_op_get_name(&op_name, op);
-            RXP_STR_CREATE_3(status,
+            RXP_STR_CREATE_4(status,
                              failure_msg,
-                             "`%s` is expected to be %s `%s`",
+                             "`%s` is expected to be %s `%s` (case: %s)",
                              expr1,
                              op_name,
-                             expr2);
+                             expr2,
+                             str_case_type);
         } else {
             RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
         }
 
         if (status != RX_SUCCESS) {
             RXP_LOG_DEBUG_2("failed to create the failure message for "
-                            "the integer comparison test located at %s:%d\n",
+                            "the string comparison test located at %s:%d\n",
                             file,
                             line);
             failure_msg = NULL;
         }
 
         rxp_op_get_symbol(&op_symbol, op);
-        RXP_STR_CREATE_3(status,
-                         diagnostic_msg,
-                         "%ld %s %ld",
-                         (long)x1,
-                         op_symbol,
-                         (long)x2);
+        RXP_STR_CREATE_3(
+            status, diagnostic_msg, "\"%s\" %s \"%s\"", s1, op_symbol, s2);
         if (status != RX_SUCCESS) {
             RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
-                            "the integer comparison test located at %s:%d\n",
+                            "the string comparison test located at %s:%d\n",
                             file,
                             line);
             diagnostic_msg = NULL;
@@ -2141,7 +10014,7 @@ rxp_int_assess_comparison(struct rx_context *context,
     if (rx_handle_test_result(
             context, result, file, line, severity, failure_msg, diagnostic_msg)
         != RX_SUCCESS) {
-        RXP_LOG_DEBUG_2("failed to handle the test result for the integer "
+        RXP_LOG_DEBUG_2("failed to handle the test result for the string "
                         "comparison test located at %s:%d\n",
                         file,
                         line);
@@ -2157,17 +10030,17 @@ rxp_int_assess_comparison(struct rx_context *context,
 
 RXP_PRINTF_CHECK(10, 0)
 RXP_MAYBE_UNUSED static void
-rxp_uint_assess_comparison(struct rx_context *context,
-                           rxp_uint x1,
-                           rxp_uint x2,
-                           enum rxp_op op,
-                           const char *expr1,
-                           const char *expr2,
-                           const char *file,
-                           int line,
-                           enum rx_severity severity,
-                           const char *failure_fmt,
-                           ...)
+rxp_ptr_assess_comparison(struct rx_context *context,
+                          const void *x1,
+                          const void *x2,
+                          enum rxp_op op,
+                          const char *expr1,
+                          const char *expr2,
+                          const char *file,
+                          int line,
+                          enum rx_severity severity,
+                          const char *failure_fmt,
+                          ...)
 {
     int result;
     char *failure_msg;
@@ -2185,18 +10058,6 @@ rxp_uint_assess_comparison(struct rx_context *context,
         case RXP_OP_NOT_EQUAL:
             result = x1 != x2;
             break;
-        case RXP_OP_GREATER:
-            result = x1 > x2;
-            break;
-        case RXP_OP_LESSER:
-            result = x1 < x2;
-            break;
-        case RXP_OP_GREATER_OR_EQUAL:
-            result = x1 >= x2;
-            break;
-        case RXP_OP_LESSER_OR_EQUAL:
-            result = x1 <= x2;
-            break;
         default:
             RX_ASSERT(0);
             result = 0;
@@ -2226,7 +10087,7 @@ rxp_uint_assess_comparison(struct rx_context *context,
 
         if (status != RX_SUCCESS) {
             RXP_LOG_DEBUG_2("failed to create the failure message for "
-                            "the unsigned integer comparison test located at "
+                            "the pointer comparison test located at "
                             "%s:%d\n",
                             file,
                             line);
@@ -2236,13 +10097,13 @@ rxp_uint_assess_comparison(struct rx_context *context,
         rxp_op_get_symbol(&op_symbol, op);
         RXP_STR_CREATE_3(status,
                          diagnostic_msg,
-                         "%lu %s %lu",
-                         (unsigned long)x1,
+                         "0x%08lx %s 0x%08lx",
+                         (uintptr_t)x1,
                          op_symbol,
-                         (unsigned long)x2);
+                         (uintptr_t)x2);
         if (status != RX_SUCCESS) {
             RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
-                            "the unsigned integer comparison test located at "
+                            "the pointer comparison test located at "
                             "%s:%d\n",
                             file,
                             line);
@@ -2253,8 +10114,8 @@ rxp_uint_assess_comparison(struct rx_context *context,
     if (rx_handle_test_result(
             context, result, file, line, severity, failure_msg, diagnostic_msg)
         != RX_SUCCESS) {
-        RXP_LOG_DEBUG_2("failed to handle the test result for the unsigned "
-                        "integer comparison test located at %s:%d\n",
+        RXP_LOG_DEBUG_2("failed to handle the test result for the pointer "
+                        "comparison test located at %s:%d\n",
                         file,
                         line);
     }
@@ -2267,96 +10128,62 @@ rxp_uint_assess_comparison(struct rx_context *context,
     }
 }
 
-RXP_PRINTF_CHECK(10, 0)
+RXP_PRINTF_CHECK(8, 0)
 RXP_MAYBE_UNUSED static void
-rxp_real_assess_comparison(struct rx_context *context,
-                           rxp_real x1,
-                           rxp_real x2,
-                           enum rxp_op op,
-                           const char *expr1,
-                           const char *expr2,
-                           const char *file,
-                           int line,
-                           enum rx_severity severity,
-                           const char *failure_fmt,
-                           ...)
-{
-    int result;
-    char *failure_msg;
-    char *diagnostic_msg;
-
-    RX_ASSERT(context != NULL);
-    RX_ASSERT(expr1 != NULL);
-    RX_ASSERT(expr2 != NULL);
-    RX_ASSERT(file != NULL);
-
-    switch (op) {
-#if defined(__GNUC__)
-    #pragma GCC diagnostic push
-    #pragma GCC diagnostic ignored "-Wfloat-equal"
-#endif
-        case RXP_OP_EQUAL:
-            result = x1 == x2;
-            break;
-        case RXP_OP_NOT_EQUAL:
-            result = x1 != x2;
-            break;
-#if defined(__GNUC__)
-    #pragma GCC diagnostic pop
-#endif
-        case RXP_OP_GREATER:
-            result = x1 > x2;
-            break;
-        case RXP_OP_LESSER:
-            result = x1 < x2;
-            break;
-        case RXP_OP_GREATER_OR_EQUAL:
-            result = x1 >= x2;
-            break;
-        case RXP_OP_LESSER_OR_EQUAL:
-            result = x1 <= x2;
-            break;
-        default:
-            RX_ASSERT(0);
-            result = 0;
-            break;
-    }
+rxp_ptr_assess_alignment(struct rx_context *context,
+                         const void *x,
+                         size_t alignment,
+                         const char *expr,
+                         const char *file,
+                         int line,
+                         enum rx_severity severity,
+                         const char *failure_fmt,
+                         ...)
+{
+    int result;
+    char *failure_msg;
+    char *diagnostic_msg;
+
+    RX_ASSERT(context != NULL);
+    RX_ASSERT(expr != NULL);
+    RX_ASSERT(file != NULL);
+
+    result = (uintptr_t)x  % alignment == 0;
 
     if (result) {
         failure_msg = NULL;
         diagnostic_msg = NULL;
     } else {
         enum rx_status status;
-        const char *op_symbol;
 
         if (failure_fmt == NULL) {
-            const char *op_name;
-
-            rxp_op_get_name(&op_name, op);
-            RXP_STR_CREATE_3(status,
+            RXP_STR_CREATE_2(status,
                              failure_msg,
-                             "`%s` is expected to be %s `%s`",
-                             expr1,
-                             op_name,
-                             expr2);
+                             "`%s` is expected to have an %lu-byte alignment",
+                             expr,
+                             (unsigned long)alignment);
         } else {
             RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
         }
 
         if (status != RX_SUCCESS) {
             RXP_LOG_DEBUG_2("failed to create the failure message for "
-                            "the real comparison test located at %s:%d\n",
+                            "the pointer alignment test located at "
+                            "%s:%d\n",
                             file,
                             line);
             failure_msg = NULL;
         }
 
-        rxp_op_get_symbol(&op_symbol, op);
-        RXP_STR_CREATE_3(
-            status, diagnostic_msg, "%Lf %s %Lf", x1, op_symbol, x2);
+        RXP_STR_CREATE_2(status,
+                         diagnostic_msg,
+                         "0x%08lx %% %lu != 0",
+                         (uintptr_t)x,
+                         (unsigned long)alignment);
         if (status != RX_SUCCESS) {
             RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
-                            "the real comparison test located at %s:%d\n",
+                            "the pointer alignment test located at "
+                            "%s:%d\n",
                             file,
                             line);
             diagnostic_msg = NULL;
@@ -2366,8 +10193,8 @@ rxp_real_assess_comparison(struct rx_context *context,
     if (rx_handle_test_result(
             context, result, file, line, severity, failure_msg, diagnostic_msg)
         != RX_SUCCESS) {
-        RXP_LOG_DEBUG_2("failed to handle the test result for the real "
-                        "comparison test located at %s:%d\n",
+        RXP_LOG_DEBUG_2("failed to handle the test result for the pointer "
+                        "alignment test located at %s:%d\n",
                         file,
                         line);
     }
@@ -2380,387 +10207,962 @@ rxp_real_assess_comparison(struct rx_context *context,
     }
 }
 
-RXP_PRINTF_CHECK(11, 0)
-RXP_MAYBE_UNUSED static void
-rxp_real_assess_fuzzy_comparison(struct rx_context *context,
-                                 rxp_real x1,
-                                 rxp_real x2,
-                                 rxp_real tol,
-                                 enum rxp_op op,
-                                 const char *expr1,
-                                 const char *expr2,
-                                 const char *file,
-                                 int line,
-                                 enum rx_severity severity,
-                                 const char *failure_fmt,
-                                 ...)
+/* Implementation: Properties                                      O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   Properties draw their inputs from a stream of choices that is recorded
+   while generating. A failing run is then replayed with simpler choices for
+   as long as it keeps failing: the stream is truncated, its choices are
+   removed and minimized one by one. Generators map smaller choices to
+   simpler values, which is what allows shrinking without knowing anything
+   about them. The values are only formatted when replaying the minimal
+   counterexample.
+*/
+
+#define RXP_PROPERTY_MAX_CHOICE_COUNT 65536
+#define RXP_PROPERTY_MAX_SHRINK_RUN_COUNT 10000
+#define RXP_PROPERTY_LOG_SIZE 512
+#define RXP_PROPERTY_LOG_MAX_BYTE_COUNT 16
+#define RXP_PROPERTY_LOG_MAX_CHAR_COUNT 32
+
+struct rxp_property {
+    rx_uint64 *choices;
+    size_t choice_count;
+    size_t cursor;
+    int replaying;
+    rx_uint32 state;
+    char *log;
+};
+
+typedef void (*rxp_property_fn)(RXP_DEFINE_PROPERTY_PARAMS);
+
+static rx_uint64
+rxp_property_draw(struct rxp_property *property, rx_uint64 bound)
 {
-    int result;
-    char *failure_msg;
-    char *diagnostic_msg;
+    rx_uint64 choice;
 
-    RX_ASSERT(context != NULL);
-    RX_ASSERT(expr1 != NULL);
-    RX_ASSERT(expr2 != NULL);
-    RX_ASSERT(file != NULL);
+    RX_ASSERT(property != NULL);
 
-    switch (op) {
-        case RXP_OP_EQUAL:
-            rxp_real_are_equal_fuzzy(&result, x1, x2, tol);
-            break;
-        case RXP_OP_NOT_EQUAL:
-            rxp_real_are_equal_fuzzy(&result, x1, x2, tol);
-            result = !result;
-            break;
-        default:
-            RX_ASSERT(0);
-            result = 0;
-            break;
+    if (property->replaying) {
+        choice = property->cursor < property->choice_count
+                     ? property->choices[property->cursor]
+                     : 0;
+        if (bound != 0) {
+            choice %= bound;
+        }
+    } else {
+        if (bound != 0 && bound <= 0xFFFFFFFFu) {
+            choice = (rx_uint64)rxp_random_below(&property->state,
+                                                 (size_t)bound);
+        } else {
+            choice = (rx_uint64)rxp_random_next(&property->state) << 32;
+            choice |= (rx_uint64)rxp_random_next(&property->state);
+            if (bound != 0) {
+                choice %= bound;
+            }
+        }
+
+        if (property->cursor < RXP_PROPERTY_MAX_CHOICE_COUNT) {
+            property->choices[property->cursor] = choice;
+        }
     }
 
-    if (result) {
-        failure_msg = NULL;
-        diagnostic_msg = NULL;
+    ++property->cursor;
+    return choice;
+}
+
+static void
+rxp_property_log(struct rxp_property *property, const char *value)
+{
+    size_t length;
+    size_t size;
+
+    RX_ASSERT(property != NULL);
+    RX_ASSERT(property->log != NULL);
+    RX_ASSERT(value != NULL);
+
+    length = strlen(property->log);
+    if (length > 0 && length + 2 < RXP_PROPERTY_LOG_SIZE) {
+        memcpy(&property->log[length], ", ", 3);
+        length += 2;
+    }
+
+    size = strlen(value);
+    if (size > RXP_PROPERTY_LOG_SIZE - 1 - length) {
+        size = RXP_PROPERTY_LOG_SIZE - 1 - length;
+    }
+
+    memcpy(&property->log[length], value, size);
+    property->log[length + size] = '\0';
+}
+
+RXP_MAYBE_UNUSED static rxp_int
+rxp_property_generate_int(struct rxp_property *property,
+                          rxp_int min,
+                          rxp_int max)
+{
+    rxp_uint width;
+    rxp_uint below;
+    rxp_uint above;
+    rxp_uint shortest;
+    rxp_uint choice;
+    rxp_uint step;
+    rxp_int origin;
+    rxp_int value;
+
+    RX_ASSERT(property != NULL);
+    RX_ASSERT(min <= max);
+
+    /*
+       Alternate around the value closest to zero, as in 0, -1, 1, -2, 2, and
+       so on, then carry on with the remaining side once the other one is
+       exhausted, so that smaller choices always give values closer to zero.
+    */
+    origin = min > 0 ? min : max < 0 ? max : 0;
+    width = (rxp_uint)max - (rxp_uint)min + 1;
+    below = (rxp_uint)origin - (rxp_uint)min;
+    above = (rxp_uint)max - (rxp_uint)origin;
+    shortest = below < above ? below : above;
+
+    choice = (rxp_uint)rxp_property_draw(property, (rx_uint64)width);
+    if (choice <= 2 * shortest) {
+        step = (choice >> 1) + (choice & 1);
+        value = (choice & 1) ? (rxp_int)((rxp_uint)origin - step)
+                             : (rxp_int)((rxp_uint)origin + step);
+    } else if (below < above) {
+        value = (rxp_int)((rxp_uint)origin + choice - shortest);
     } else {
-        enum rx_status status;
-        const char *op_symbol;
+        value = (rxp_int)((rxp_uint)origin - (choice - shortest));
+    }
 
-        if (failure_fmt == NULL) {
-            const char *op_name;
+    if (property->log != NULL) {
+        char buffer[32];
 
-            rxp_op_get_name(&op_name, op);
-            RXP_STR_CREATE_4(status,
-                             failure_msg,
-                             "`%s` is expected to be almost %s `%s` "
-                             "(tolerance: %Lf)",
-                             expr1,
-                             op_name,
-                             expr2,
-                             tol);
-        } else {
-            RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
+        sprintf(buffer, "%ld", (long)value);
+        rxp_property_log(property, buffer);
+    }
+
+    return value;
+}
+
+RXP_MAYBE_UNUSED static rxp_uint
+rxp_property_generate_uint(struct rxp_property *property,
+                           rxp_uint min,
+                           rxp_uint max)
+{
+    rxp_uint value;
+
+    RX_ASSERT(property != NULL);
+    RX_ASSERT(min <= max);
+
+    value = min
+            + (rxp_uint)rxp_property_draw(property,
+                                          (rx_uint64)(max - min + 1));
+
+    if (property->log != NULL) {
+        char buffer[32];
+
+        sprintf(buffer, "%lu", (unsigned long)value);
+        rxp_property_log(property, buffer);
+    }
+
+    return value;
+}
+
+RXP_MAYBE_UNUSED static rxp_real
+rxp_property_generate_real(struct rxp_property *property,
+                           rxp_real min,
+                           rxp_real max)
+{
+    rx_uint64 choice;
+    rxp_real fraction;
+    rxp_real origin;
+    rxp_real value;
+
+    RX_ASSERT(property != NULL);
+    RX_ASSERT(min <= max);
+
+    /* The upper 53 bits give the fraction and the lowest one the side. */
+    choice = rxp_property_draw(property, 0);
+    fraction = (rxp_real)(choice >> 11) / (rxp_real)9007199254740992.0;
+    origin = min > 0 ? min : max < 0 ? max : 0;
+    value = (choice & 1) ? origin - fraction * (origin - min)
+                         : origin + fraction * (max - origin);
+
+    if (property->log != NULL) {
+        char buffer[64];
+
+        sprintf(buffer, "%Lg", value);
+        rxp_property_log(property, buffer);
+    }
+
+    return value;
+}
+
+RXP_MAYBE_UNUSED static rx_size
+rxp_property_generate_bytes(struct rxp_property *property,
+                            void *buf,
+                            rx_size min_size,
+                            rx_size max_size)
+{
+    unsigned char *bytes;
+    rx_size size;
+    rx_size i;
+
+    RX_ASSERT(property != NULL);
+    RX_ASSERT(buf != NULL);
+    RX_ASSERT(min_size <= max_size);
+
+    bytes = (unsigned char *)buf;
+    size = min_size
+           + (rx_size)rxp_property_draw(property,
+                                        (rx_uint64)(max_size - min_size + 1));
+    for (i = 0; i < size; ++i) {
+        bytes[i] = (unsigned char)rxp_property_draw(property, 256);
+    }
+
+    if (property->log != NULL) {
+        char buffer[32 + 3 * RXP_PROPERTY_LOG_MAX_BYTE_COUNT];
+        char *it;
+
+        it = buffer;
+        it += sprintf(it, "bytes(%lu)[", (unsigned long)size);
+        for (i = 0; i < size && i < RXP_PROPERTY_LOG_MAX_BYTE_COUNT; ++i) {
+            if (i > 0) {
+                *it++ = ' ';
+            }
+
+            it += sprintf(it, "%02x", bytes[i]);
+        }
+
+        strcpy(it, size > RXP_PROPERTY_LOG_MAX_BYTE_COUNT ? " ...]" : "]");
+        rxp_property_log(property, buffer);
+    }
+
+    return size;
+}
+
+RXP_MAYBE_UNUSED static rx_size
+rxp_property_generate_str(struct rxp_property *property,
+                          char *buf,
+                          rx_size min_length,
+                          rx_size max_length)
+{
+    rx_size length;
+    rx_size i;
+
+    RX_ASSERT(property != NULL);
+    RX_ASSERT(buf != NULL);
+    RX_ASSERT(min_length <= max_length);
+
+    length = min_length
+             + (rx_size)rxp_property_draw(
+                 property, (rx_uint64)(max_length - min_length + 1));
+
+    /* Printable characters, starting from `a` to shrink towards it. */
+    for (i = 0; i < length; ++i) {
+        buf[i] = (char)(' ' + (rxp_property_draw(property, 95) + 65) % 95);
+    }
+
+    buf[length] = '\0';
+
+    if (property->log != NULL) {
+        char buffer[8 + RXP_PROPERTY_LOG_MAX_CHAR_COUNT];
+
+        buffer[0] = '"';
+        for (i = 0; i < length && i < RXP_PROPERTY_LOG_MAX_CHAR_COUNT; ++i) {
+            buffer[i + 1] = buf[i];
+        }
+
+        strcpy(&buffer[i + 1],
+               length > RXP_PROPERTY_LOG_MAX_CHAR_COUNT ? "\"..." : "\"");
+        rxp_property_log(property, buffer);
+    }
+
+    return length;
+}
+
+static void
+rxp_property_summary_clear(struct rx_summary *summary)
+{
+    size_t i;
+
+    RX_ASSERT(summary != NULL);
+
+    for (i = 0; i < summary->failure_count; ++i) {
+        RX_FREE((void *)(uintptr_t)summary->failures[i].file);
+        RX_FREE((void *)(uintptr_t)summary->failures[i].msg);
+        RX_FREE((void *)(uintptr_t)summary->failures[i].diagnostic_msg);
+    }
+
+    rxp_test_failure_array_clear(summary->failures);
+    summary->failure_count = 0;
+    summary->error = NULL;
+}
+
+static int
+rxp_property_run(struct rxp_property *property,
+                 struct rx_context *context,
+                 void *data,
+                 rxp_property_fn fn)
+{
+    size_t failure_count;
+
+    RX_ASSERT(property != NULL);
+    RX_ASSERT(context != NULL);
+    RX_ASSERT(fn != NULL);
+
+    failure_count = context->summary->failure_count;
+    property->cursor = 0;
+
+    if (setjmp(context->env) == 0) {
+        fn(context, data, property);
+    }
+
+    return context->summary->failure_count > failure_count;
+}
+
+static int
+rxp_property_replay(struct rxp_property *property,
+                    size_t *run_count,
+                    struct rx_context *context,
+                    void *data,
+                    rxp_property_fn fn)
+{
+    int failed;
+
+    RX_ASSERT(run_count != NULL);
+
+    ++*run_count;
+    failed = rxp_property_run(property, context, data, fn);
+    rxp_property_summary_clear(context->summary);
+
+    /* Choices that weren't drawn can be dropped. */
+    if (failed && property->cursor < property->choice_count) {
+        property->choice_count = property->cursor;
+    }
+
+    return failed;
+}
+
+static size_t
+rxp_property_shrink(struct rxp_property *property,
+                    struct rx_context *context,
+                    void *data,
+                    rxp_property_fn fn)
+{
+    size_t shrink_count;
+    size_t run_count;
+    int shrunk;
+
+    RX_ASSERT(property != NULL);
+
+    shrink_count = 0;
+    run_count = 0;
+    property->replaying = RXP_TRUE;
+
+    /* Choices beyond the recorded ones might not replay the failure. */
+    if (!rxp_property_replay(property, &run_count, context, data, fn)) {
+        return 0;
+    }
+
+    do {
+        size_t i;
+        size_t size;
+
+        shrunk = RXP_FALSE;
+
+        /* Choices that are missing at the end are replayed as zeros. */
+        for (size = property->choice_count / 2; size > 0; size /= 2) {
+            size_t choice_count;
+
+            choice_count = property->choice_count;
+            property->choice_count -= size;
+            if (rxp_property_replay(property, &run_count, context, data, fn)) {
+                shrunk = RXP_TRUE;
+                ++shrink_count;
+                break;
+            }
+
+            property->choice_count = choice_count;
+        }
+
+        for (i = property->choice_count; i-- > 0;) {
+            rx_uint64 choice;
+
+            if (run_count >= RXP_PROPERTY_MAX_SHRINK_RUN_COUNT) {
+                break;
+            }
+
+            if (i >= property->choice_count) {
+                continue;
+            }
+
+            choice = property->choices[i];
+            memmove(&property->choices[i],
+                    &property->choices[i + 1],
+                    sizeof *property->choices
+                        * (property->choice_count - i - 1));
+            --property->choice_count;
+            if (rxp_property_replay(property, &run_count, context, data, fn)) {
+                shrunk = RXP_TRUE;
+                ++shrink_count;
+                continue;
+            }
+
+            memmove(&property->choices[i + 1],
+                    &property->choices[i],
+                    sizeof *property->choices * (property->choice_count - i));
+            property->choices[i] = choice;
+            ++property->choice_count;
+        }
+
+        for (i = 0; i < property->choice_count; ++i) {
+            rx_uint64 lower;
+            rx_uint64 upper;
+
+            /* Binary search for the smallest choice that still fails. */
+            lower = 0;
+            upper = property->choices[i];
+            while (upper > lower
+                   && run_count < RXP_PROPERTY_MAX_SHRINK_RUN_COUNT) {
+                rx_uint64 middle;
+
+                middle = lower + (upper - lower) / 2;
+                property->choices[i] = middle;
+                if (rxp_property_replay(
+                        property, &run_count, context, data, fn)) {
+                    upper = middle;
+                    shrunk = RXP_TRUE;
+                    ++shrink_count;
+                } else {
+                    lower = middle + 1;
+                }
+
+                if (i >= property->choice_count) {
+                    break;
+                }
+            }
+
+            if (i < property->choice_count) {
+                property->choices[i] = upper;
+            }
         }
+    } while (shrunk && run_count < RXP_PROPERTY_MAX_SHRINK_RUN_COUNT);
+
+    return shrink_count;
+}
+
+RXP_MAYBE_UNUSED static void
+rxp_property_check(struct rx_context *context,
+                   void *data,
+                   rxp_property_fn fn,
+                   const char *name,
+                   const char *file,
+                   int line,
+                   enum rx_severity severity)
+{
+    enum rx_status status;
+    struct rxp_property property;
+    struct rx_summary summary;
+    struct rx_context property_context;
+    const struct rxp_settings *settings;
+    size_t run_count;
+    size_t i;
+    size_t shrink_count;
+    int failed;
+    const char *it;
+    char log[RXP_PROPERTY_LOG_SIZE];
+    char *failure_msg;
+    char *diagnostic_msg;
+
+    RX_ASSERT(context != NULL);
+    RX_ASSERT(context->summary != NULL);
+    RX_ASSERT(fn != NULL);
+    RX_ASSERT(name != NULL);
+    RX_ASSERT(file != NULL);
+
+    /* Failing to set up the property fails the assessment. */
+    failed = RXP_TRUE;
+
+    memset(&property, 0, sizeof property);
+    property.choices = (rx_uint64 *)RX_MALLOC(sizeof *property.choices
+                                              * RXP_PROPERTY_MAX_CHOICE_COUNT);
+    if (property.choices == NULL) {
+        RXP_LOG_ERROR_1("failed to allocate the choices of the property `%s`\n",
+                        name);
+        rx_handle_test_result(context,
+                              RXP_FALSE,
+                              file,
+                              line,
+                              severity,
+                              "failed to allocate the property",
+                              NULL);
+        goto abort;
+    }
 
-        if (status != RX_SUCCESS) {
-            RXP_LOG_DEBUG_2("failed to create the failure message for "
-                            "the real almost equal test located at %s:%d\n",
-                            file,
-                            line);
-            failure_msg = NULL;
-        }
+    if (rx_summary_initialize(&summary, context->summary->test_case)
+        != RX_SUCCESS) {
+        rx_handle_test_result(context,
+                              RXP_FALSE,
+                              file,
+                              line,
+                              severity,
+                              "failed to initialize the property",
+                              NULL);
+        goto choices_cleanup;
+    }
 
-        rxp_op_get_symbol(&op_symbol, op);
-        RXP_STR_CREATE_3(
-            status, diagnostic_msg, "%Lf %s %Lf", x1, op_symbol, x2);
-        if (status != RX_SUCCESS) {
-            RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
-                            "the real almost equal test located at %s:%d\n",
-                            file,
-                            line);
-            diagnostic_msg = NULL;
+    property_context = *context;
+    property_context.summary = &summary;
+
+    settings = rxp_context_get_settings(context);
+
+    /* Give each property its own sequence, replayable from the same seed. */
+    property.state = settings->property_seed;
+    for (it = name; *it != '\0'; ++it) {
+        property.state = ((property.state ^ (rx_uint32)(unsigned char)*it)
+                          * 16777619u)
+                         & 0xFFFFFFFFu;
+    }
+
+    run_count = settings->property_run_count;
+    failed = RXP_FALSE;
+    for (i = 0; i < run_count; ++i) {
+        if (rxp_property_run(&property, &property_context, data, fn)) {
+            failed = RXP_TRUE;
+            break;
         }
     }
 
-    if (rx_handle_test_result(
-            context, result, file, line, severity, failure_msg, diagnostic_msg)
-        != RX_SUCCESS) {
-        RXP_LOG_DEBUG_2("failed to handle the test result for the real "
-                        "almost equal test located at %s:%d\n",
-                        file,
-                        line);
+    if (!failed) {
+        rx_handle_test_result(
+            context, RXP_TRUE, file, line, severity, NULL, NULL);
+        goto summary_cleanup;
+    }
+
+    property.choice_count = property.cursor < RXP_PROPERTY_MAX_CHOICE_COUNT
+                                ? property.cursor
+                                : RXP_PROPERTY_MAX_CHOICE_COUNT;
+    rxp_property_summary_clear(&summary);
+    shrink_count = rxp_property_shrink(
+        &property, &property_context, data, fn);
+
+    /* Replay the counterexample to report its failures and values. */
+    log[0] = '\0';
+    property.log = log;
+    property.replaying = RXP_TRUE;
+    property_context.summary = context->summary;
+    rxp_property_run(&property, &property_context, data, fn);
+
+    RXP_STR_CREATE_4(status,
+                     failure_msg,
+                     "the property `%s` failed after %lu run(s) "
+                     "(seed: %lu, shrinks: %lu)",
+                     name,
+                     (unsigned long)i + 1,
+                     (unsigned long)settings->property_seed,
+                     (unsigned long)shrink_count);
+    if (status != RX_SUCCESS) {
+        failure_msg = NULL;
+    }
+
+    RXP_STR_CREATE_1(status, diagnostic_msg, "counterexample: %s", log);
+    if (status != RX_SUCCESS) {
+        diagnostic_msg = NULL;
     }
 
+    rx_handle_test_result(
+        context, RXP_FALSE, file, line, severity, failure_msg, diagnostic_msg);
     RX_FREE(failure_msg);
     RX_FREE(diagnostic_msg);
 
-    if (!result && severity == RX_FATAL) {
+summary_cleanup:
+    rx_summary_terminate(&summary);
+
+choices_cleanup:
+    RX_FREE(property.choices);
+
+    if (!failed) {
+        return;
+    }
+
+abort:
+    if (severity == RX_FATAL) {
         rx_abort(context);
     }
 }
 
-RXP_PRINTF_CHECK(11, 0)
-RXP_MAYBE_UNUSED static void
-rxp_str_assess_comparison(struct rx_context *context,
-                          const char *s1,
-                          const char *s2,
-                          enum rxp_str_case str_case,
-                          enum rxp_op op,
-                          const char *expr1,
-                          const char *expr2,
-                          const char *file,
-                          int line,
-                          enum rx_severity severity,
-                          const char *failure_fmt,
-                          ...)
+/* Implementation: Fuzzing                                         O-(''Q)
+   -------------------------------------------------------------------------- */
+
+/*
+   When run as a regular test case, a fuzz test replays the empty input
+   followed by each file found in its corpus directory, at
+   `<corpus>/<suite>/<name>/`. Each input runs in its own context, so that
+   a fatal failure only stops that input.
+
+   Defining `RX_ENABLE_FUZZING` in a single translation unit also defines the
+   `LLVMFuzzerTestOneInput` entry point, which runs each input through all the
+   fuzz tests matching the glob pattern found in the `RX_FUZZ_TEST`
+   environment variable, if any. These are looked up once, and any failure is
+   turned into an abort for the fuzzer to record the input as a crash.
+*/
+
+static int
+rxp_fuzz_test_run_input(struct rx_context *context,
+                        void *data,
+                        rxp_fuzz_fn fn,
+                        const uint8_t *input,
+                        size_t size)
 {
-    int result;
-    char *failure_msg;
-    char *diagnostic_msg;
+    struct rx_context fuzz_context;
+    size_t failure_count;
 
     RX_ASSERT(context != NULL);
-    RX_ASSERT(s1 != NULL);
-    RX_ASSERT(s2 != NULL);
-    RX_ASSERT(expr1 != NULL);
-    RX_ASSERT(expr2 != NULL);
-    RX_ASSERT(file != NULL);
+    RX_ASSERT(context->summary != NULL);
+    RX_ASSERT(fn != NULL);
+    RX_ASSERT(input != NULL);
 
-    switch (op) {
-        case RXP_OP_EQUAL:
-            str_case == RXP_STR_CASE_OBEY
-                ? rxp_str_are_equal(&result, s1, s2)
-                : rxp_str_are_equal_no_case(&result, s1, s2);
-            break;
-        case RXP_OP_NOT_EQUAL:
-            str_case == RXP_STR_CASE_OBEY
-                ? rxp_str_are_equal(&result, s1, s2)
-                : rxp_str_are_equal_no_case(&result, s1, s2);
-            result = !result;
-            break;
-        default:
-            RX_ASSERT(0);
-            result = 0;
-            break;
+    fuzz_context = *context;
+    failure_count = context->summary->failure_count;
+
+    if (setjmp(fuzz_context.env) == 0) {
+        fn(&fuzz_context, data, input, size);
     }
 
-    if (result) {
-        failure_msg = NULL;
-        diagnostic_msg = NULL;
-    } else {
-        enum rx_status status;
-        const char *op_symbol;
+    context->file = fuzz_context.file;
+    context->line = fuzz_context.line;
+    return context->summary->failure_count == failure_count;
+}
 
-        if (failure_fmt == NULL) {
-            const char *str_case_type;
-            const char *op_name;
+static void
+rxp_fuzz_test_report_input(struct rx_context *context,
+                           int passed,
+                           const char *input_name)
+{
+    enum rx_status status;
+    char *msg;
 
-            rxp_str_case_get_type(&str_case_type, str_case);
-            rxp_op_get_name(&op_name, op);
-            RXP_STR_CREATE_4(status,
-                             failure_msg,
-                             "`%s` is expected to be %s `%s` (case: %s)",
-                             expr1,
-                             op_name,
-                             expr2,
-                             str_case_type);
-        } else {
-            RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
-        }
+    RX_ASSERT(context != NULL);
+    RX_ASSERT(input_name != NULL);
 
+    msg = NULL;
+    if (!passed) {
+        RXP_STR_CREATE_1(
+            status, msg, "the fuzz input `%s` failed", input_name);
         if (status != RX_SUCCESS) {
-            RXP_LOG_DEBUG_2("failed to create the failure message for "
-                            "the string comparison test located at %s:%d\n",
-                            file,
-                            line);
-            failure_msg = NULL;
+            msg = NULL;
         }
+    }
 
-        rxp_op_get_symbol(&op_symbol, op);
-        RXP_STR_CREATE_3(
-            status, diagnostic_msg, "\"%s\" %s \"%s\"", s1, op_symbol, s2);
-        if (status != RX_SUCCESS) {
-            RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
-                            "the string comparison test located at %s:%d\n",
-                            file,
-                            line);
-            diagnostic_msg = NULL;
-        }
+    rx_handle_test_result(context,
+                          passed,
+                          context->file == NULL ? "<unknown>" : context->file,
+                          context->line,
+                          RX_NONFATAL,
+                          msg,
+                          NULL);
+    RX_FREE(msg);
+}
+
+#if RXP_HAS_DIRENT
+static void
+rxp_fuzz_test_replay_corpus(struct rx_context *context,
+                            void *data,
+                            rxp_fuzz_fn fn,
+                            const char *corpus_path,
+                            const char *suite_name,
+                            const char *name)
+{
+    enum rx_status status;
+    char *dir_path;
+    DIR *dir;
+    struct dirent *entry;
+
+    RX_ASSERT(corpus_path != NULL);
+
+    RXP_STR_CREATE_3(
+        status, dir_path, "%s/%s/%s", corpus_path, suite_name, name);
+    if (status != RX_SUCCESS) {
+        RXP_LOG_ERROR("failed to create the path of the corpus\n");
+        return;
     }
 
-    if (rx_handle_test_result(
-            context, result, file, line, severity, failure_msg, diagnostic_msg)
-        != RX_SUCCESS) {
-        RXP_LOG_DEBUG_2("failed to handle the test result for the string "
-                        "comparison test located at %s:%d\n",
-                        file,
-                        line);
+    /* Fuzz tests without any corpus yet only replay the empty input. */
+    dir = opendir(dir_path);
+    if (dir == NULL) {
+        RXP_LOG_DEBUG_1("no corpus found at `%s`\n", dir_path);
+        RX_FREE(dir_path);
+        return;
     }
 
-    RX_FREE(failure_msg);
-    RX_FREE(diagnostic_msg);
+    while ((entry = readdir(dir)) != NULL) {
+        char *path;
+        char *input;
+        size_t size;
+        struct stat info;
 
-    if (!result && severity == RX_FATAL) {
-        rx_abort(context);
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+
+        RXP_STR_CREATE_2(status, path, "%s/%s", dir_path, entry->d_name);
+        if (status != RX_SUCCESS) {
+            RXP_LOG_ERROR("failed to create the path of a corpus input\n");
+            continue;
+        }
+
+        if (stat(path, &info) != 0 || !S_ISREG(info.st_mode)
+            || rxp_file_read(&input, &size, path) != RX_SUCCESS) {
+            RX_FREE(path);
+            continue;
+        }
+
+        rxp_fuzz_test_report_input(
+            context,
+            rxp_fuzz_test_run_input(
+                context, data, fn, (const uint8_t *)input, size),
+            path);
+        RX_FREE(input);
+        RX_FREE(path);
     }
+
+    closedir(dir);
+    RX_FREE(dir_path);
 }
+#endif /* RXP_HAS_DIRENT */
 
-RXP_PRINTF_CHECK(10, 0)
 RXP_MAYBE_UNUSED static void
-rxp_ptr_assess_comparison(struct rx_context *context,
-                          const void *x1,
-                          const void *x2,
-                          enum rxp_op op,
-                          const char *expr1,
-                          const char *expr2,
-                          const char *file,
-                          int line,
-                          enum rx_severity severity,
-                          const char *failure_fmt,
-                          ...)
+rxp_fuzz_test_replay(struct rx_context *context,
+                     void *data,
+                     rxp_fuzz_fn fn,
+                     const char *suite_name,
+                     const char *name)
 {
-    int result;
-    char *failure_msg;
-    char *diagnostic_msg;
+    static const uint8_t empty = 0;
+    const char *corpus_path;
 
     RX_ASSERT(context != NULL);
-    RX_ASSERT(expr1 != NULL);
-    RX_ASSERT(expr2 != NULL);
-    RX_ASSERT(file != NULL);
+    RX_ASSERT(fn != NULL);
+    RX_ASSERT(suite_name != NULL);
+    RX_ASSERT(name != NULL);
 
-    switch (op) {
-        case RXP_OP_EQUAL:
-            result = x1 == x2;
-            break;
-        case RXP_OP_NOT_EQUAL:
-            result = x1 != x2;
-            break;
-        default:
-            RX_ASSERT(0);
-            result = 0;
-            break;
+    rxp_fuzz_test_report_input(
+        context,
+        rxp_fuzz_test_run_input(context, data, fn, &empty, 0),
+        "<empty>");
+
+    corpus_path = rxp_context_get_settings(context)->corpus_path;
+    if (corpus_path == NULL) {
+        return;
     }
 
-    if (result) {
-        failure_msg = NULL;
-        diagnostic_msg = NULL;
-    } else {
-        enum rx_status status;
-        const char *op_symbol;
+#if RXP_HAS_DIRENT
+    rxp_fuzz_test_replay_corpus(
+        context, data, fn, corpus_path, suite_name, name);
+#else
+    RXP_LOG_WARNING("replaying a corpus is not supported on this "
+                    "platform\n");
+#endif
+}
 
-        if (failure_fmt == NULL) {
-            const char *op_name;
+#if defined(RX_ENABLE_FUZZING)
+struct rxp_fuzz_target {
+    const struct rxp_test_case_desc *desc;
+    struct rx_fixture fixture;
+};
 
-            rxp_op_get_name(&op_name, op);
-            RXP_STR_CREATE_3(status,
-                             failure_msg,
-                             "`%s` is expected to be %s `%s`",
-                             expr1,
-                             op_name,
-                             expr2);
-        } else {
-            RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
-        }
+struct rxp_fuzz_dispatcher {
+    int ready;
+    struct rxp_fuzz_target *targets;
+    size_t target_count;
+};
 
-        if (status != RX_SUCCESS) {
-            RXP_LOG_DEBUG_2("failed to create the failure message for "
-                            "the pointer comparison test located at "
-                            "%s:%d\n",
-                            file,
-                            line);
-            failure_msg = NULL;
+static struct rxp_fuzz_dispatcher rxp_fuzz_dispatcher_instance
+    = {0, NULL, 0};
+
+static void
+rxp_fuzz_dispatcher_initialize(struct rxp_fuzz_dispatcher *dispatcher)
+{
+    RX_ASSERT(dispatcher != NULL);
+
+    dispatcher->ready = RXP_TRUE;
+
+#if RXP_TEST_DISCOVERY
+    {
+        const char *pattern;
+        const struct rxp_test_case_desc * const *c_it;
+        size_t count;
+
+        pattern = getenv("RX_FUZZ_TEST");
+
+        count = (size_t)(RXP_TEST_CASE_SECTION_END
+                         - RXP_TEST_CASE_SECTION_BEGIN);
+        dispatcher->targets = (struct rxp_fuzz_target *)RX_MALLOC(
+            sizeof *dispatcher->targets * (count > 0 ? count : 1));
+        if (dispatcher->targets == NULL) {
+            RXP_LOG_ERROR("failed to allocate the fuzz targets\n");
+            return;
         }
 
-        rxp_op_get_symbol(&op_symbol, op);
-        RXP_STR_CREATE_3(status,
-                         diagnostic_msg,
-                         "0x%08lx %s 0x%08lx",
-                         (uintptr_t)x1,
-                         op_symbol,
-                         (uintptr_t)x2);
-        if (status != RX_SUCCESS) {
-            RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
-                            "the pointer comparison test located at "
-                            "%s:%d\n",
-                            file,
-                            line);
-            diagnostic_msg = NULL;
+        for (c_it = RXP_TEST_CASE_SECTION_BEGIN;
+             c_it != RXP_TEST_CASE_SECTION_END;
+             ++c_it) {
+            struct rxp_test_case_config_blueprint config_blueprint;
+            struct rxp_fuzz_target *target;
+
+            if (*c_it == NULL || (*c_it)->fuzz == NULL) {
+                continue;
+            }
+
+            if (pattern != NULL
+                && !rxp_glob_match(
+                    pattern, (*c_it)->suite_name, (*c_it)->name)) {
+                continue;
+            }
+
+            rxp_test_case_desc_get_config(&config_blueprint, *c_it);
+            if (config_blueprint.skip) {
+                continue;
+            }
+
+            /* Only the fixtures whose lifetime is bound to a single test
+               case run can be set up around each input. */
+            if (config_blueprint.shared_fixture != NULL
+                || config_blueprint.session_fixture != NULL) {
+                RXP_LOG_WARNING_2("the fuzz test \"%s\" / \"%s\" depends on "
+                                  "a shared or session fixture, which "
+                                  "isn't supported when fuzzing\n",
+                                  (*c_it)->suite_name,
+                                  (*c_it)->name);
+                continue;
+            }
+
+            target = &dispatcher->targets[dispatcher->target_count];
+            target->desc = *c_it;
+            rxp_fixture_initialize(&target->fixture, config_blueprint.fixture);
+            ++dispatcher->target_count;
         }
     }
+#endif
 
-    if (rx_handle_test_result(
-            context, result, file, line, severity, failure_msg, diagnostic_msg)
+    if (dispatcher->target_count == 0) {
+        RXP_LOG_WARNING("no fuzz test to run\n");
+    }
+}
+
+static int
+rxp_fuzz_target_run_input(const struct rxp_fuzz_target *target,
+                          struct rx_context *context,
+                          const uint8_t *input,
+                          size_t size)
+{
+    const struct rx_fixture *fixture;
+    struct rxp_data_block block;
+    int passed;
+
+    RX_ASSERT(target != NULL);
+    RX_ASSERT(context != NULL);
+
+    fixture = &target->fixture;
+    if (rxp_data_block_allocate(
+            &block, NULL, (size_t)fixture->size, &fixture->config)
         != RX_SUCCESS) {
-        RXP_LOG_DEBUG_2("failed to handle the test result for the pointer "
-                        "comparison test located at %s:%d\n",
-                        file,
-                        line);
+        rxp_summary_add_failure(context->summary,
+                                "<unknown>",
+                                0,
+                                RX_FATAL,
+                                "failed to allocate the data");
+        return RXP_FALSE;
     }
 
-    RX_FREE(failure_msg);
-    RX_FREE(diagnostic_msg);
+    if (fixture->config.set_up != NULL
+        && fixture->config.set_up(context, block.data) != RX_SUCCESS) {
+        rxp_summary_add_failure(context->summary,
+                                "<unknown>",
+                                0,
+                                RX_FATAL,
+                                "failed to set-up the fixture");
+        rxp_data_block_free(&block, NULL);
+        return RXP_FALSE;
+    }
 
-    if (!result && severity == RX_FATAL) {
-        rx_abort(context);
+    passed = rxp_fuzz_test_run_input(
+        context, block.data, target->desc->fuzz, input, size);
+
+    if (fixture->config.tear_down != NULL) {
+        fixture->config.tear_down(context, block.data);
     }
+
+    rxp_data_block_free(&block, NULL);
+    return passed;
 }
 
-RXP_PRINTF_CHECK(8, 0)
-RXP_MAYBE_UNUSED static void
-rxp_ptr_assess_alignment(struct rx_context *context,
-                         const void *x,
-                         size_t alignment,
-                         const char *expr,
-                         const char *file,
-                         int line,
-                         enum rx_severity severity,
-                         const char *failure_fmt,
-                         ...)
+static int
+rxp_fuzz_dispatch(const uint8_t *input, size_t size)
 {
-    int result;
-    char *failure_msg;
-    char *diagnostic_msg;
+    struct rxp_fuzz_dispatcher *dispatcher;
+    size_t i;
 
-    RX_ASSERT(context != NULL);
-    RX_ASSERT(expr != NULL);
-    RX_ASSERT(file != NULL);
+    dispatcher = &rxp_fuzz_dispatcher_instance;
+    if (!dispatcher->ready) {
+        rxp_fuzz_dispatcher_initialize(dispatcher);
+    }
 
-    result = (uintptr_t)x  % alignment == 0;
+    for (i = 0; i < dispatcher->target_count; ++i) {
+        const struct rxp_fuzz_target *target;
+        struct rx_test_case test_case;
+        struct rx_summary summary;
+        struct rx_context context;
+        int passed;
 
-    if (result) {
-        failure_msg = NULL;
-        diagnostic_msg = NULL;
-    } else {
-        enum rx_status status;
+        target = &dispatcher->targets[i];
 
-        if (failure_fmt == NULL) {
-            RXP_STR_CREATE_2(status,
-                             failure_msg,
-                             "`%s` is expected to have an %lu-byte alignment",
-                             expr,
-                             (unsigned long)alignment);
-        } else {
-            RXP_STR_CREATE_VA_LIST(status, failure_msg, failure_fmt);
-        }
+        memset(&test_case, 0, sizeof test_case);
+        test_case.suite_name = target->desc->suite_name;
+        test_case.name = target->desc->name;
+        test_case.run = target->desc->run;
+        test_case.config.fixture = target->fixture;
 
-        if (status != RX_SUCCESS) {
-            RXP_LOG_DEBUG_2("failed to create the failure message for "
-                            "the pointer alignment test located at "
-                            "%s:%d\n",
-                            file,
-                            line);
-            failure_msg = NULL;
+        if (rx_summary_initialize(&summary, &test_case) != RX_SUCCESS) {
+            abort();
         }
 
-        RXP_STR_CREATE_2(status,
-                         diagnostic_msg,
-                         "0x%08lx %% %lu != 0",
-                         (uintptr_t)x,
-                         (unsigned long)alignment);
-        if (status != RX_SUCCESS) {
-            RXP_LOG_DEBUG_2("failed to create the diagnostic message for "
-                            "the pointer alignment test located at "
-                            "%s:%d\n",
-                            file,
-                            line);
-            diagnostic_msg = NULL;
+        memset(&context, 0, sizeof context);
+        context.summary = &summary;
+        passed = rxp_fuzz_target_run_input(target, &context, input, size);
+
+        if (!passed) {
+            rx_summary_print(&summary);
+            fflush(stdout);
+            abort();
         }
-    }
 
-    if (rx_handle_test_result(
-            context, result, file, line, severity, failure_msg, diagnostic_msg)
-        != RX_SUCCESS) {
-        RXP_LOG_DEBUG_2("failed to handle the test result for the pointer "
-                        "alignment test located at %s:%d\n",
-                        file,
-                        line);
+        rx_summary_terminate(&summary);
     }
 
-    RX_FREE(failure_msg);
-    RX_FREE(diagnostic_msg);
+    return 0;
+}
 
-    if (!result && severity == RX_FATAL) {
-        rx_abort(context);
-    }
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+int
+LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+int
+LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    return rxp_fuzz_dispatch(size > 0 ? data : (const uint8_t *)"", size);
+}
+
+#if defined(__cplusplus)
 }
+#endif
+#endif /* RX_ENABLE_FUZZING */
 
 /* Implementation: Public API                                      O-(''Q)
    -------------------------------------------------------------------------- */
@@ -2793,6 +11195,8 @@ rx_handle_test_result(struct rx_context *context,
     summary = context->summary;
 
     ++summary->assessed_count;
+    context->file = file;
+    context->line = line;
 
     if (result) {
         return RX_SUCCESS;
@@ -2930,9 +11334,10 @@ rx_summary_print(const struct rx_summary *summary)
 
 #if RXP_LOG_STYLING
     if (RXP_ISATTY(RXP_FILENO(stderr))) {
-        rxp_log_style_get_ansi_code(
-            &style_begin,
-            passed ? RXP_LOG_STYLE_BRIGHT_GREEN : RXP_LOG_STYLE_BRIGHT_RED);
+        rxp_log_style_get_ansi_code(&style_begin,
+                                    summary->cached ? RXP_LOG_STYLE_BRIGHT_CYAN
+                                    : passed ? RXP_LOG_STYLE_BRIGHT_GREEN
+                                             : RXP_LOG_STYLE_BRIGHT_RED);
         rxp_log_style_get_ansi_code(&style_end, RXP_LOG_STYLE_RESET);
     } else {
         style_begin = style_end = "";
@@ -2941,15 +11346,32 @@ rx_summary_print(const struct rx_summary *summary)
     style_begin = style_end = "";
 #endif
 
+    RXP_LOCK_FILE(stderr);
+
     fprintf(stderr,
             "[%s%s%s] \"%s\" / \"%s\" (%f ms)\n",
             style_begin,
-            passed ? "PASSED" : "FAILED",
+            summary->cached ? "CACHED"
+            : passed        ? "PASSED"
+                            : "FAILED",
             style_end,
             summary->test_case->suite_name,
             summary->test_case->name,
             (double)summary->elapsed * (1000.0 / RXP_TICKS_PER_SECOND));
 
+    if (summary->benchmark.sample_count > 0) {
+        fprintf(stderr,
+                "ns/op: %.3f min, %.3f median, %.3f mean, %.3f stddev, "
+                "%.3f p99 (%lu samples of %lu iterations)\n",
+                summary->benchmark.min,
+                summary->benchmark.median,
+                summary->benchmark.mean,
+                summary->benchmark.stddev,
+                summary->benchmark.p99,
+                (unsigned long)summary->benchmark.sample_count,
+                (unsigned long)summary->benchmark.iteration_count);
+    }
+
     for (i = 0; i < summary->failure_count; ++i) {
         const struct rx_failure *failure;
         const char *failure_msg;
@@ -2974,6 +11396,8 @@ rx_summary_print(const struct rx_summary *summary)
                     failure_msg);
         }
     }
+
+    RXP_UNLOCK_FILE(stderr);
 }
 
 RXP_MAYBE_UNUSED RXP_STORAGE void
@@ -3038,191 +11462,31 @@ RXP_MAYBE_UNUSED RXP_STORAGE enum rx_status
 rx_test_case_run(struct rx_summary *summary,
                  const struct rx_test_case *test_case)
 {
-    enum rx_status status;
-    struct rx_context context;
-    void *data;
-    uint64_t time_begin;
-    uint64_t time_end;
-
-    RX_ASSERT(summary != NULL);
-    RX_ASSERT(test_case != NULL);
-    RX_ASSERT(test_case->suite_name != NULL);
-    RX_ASSERT(test_case->name != NULL);
-    RX_ASSERT(test_case->run != NULL);
-
-    if (test_case->config.skip) {
-        summary->skipped = 1;
-        return RX_SUCCESS;
-    }
-
-    status = RX_SUCCESS;
-    context.summary = summary;
-
-    if (test_case->config.fixture.size > 0) {
-        data = RX_MALLOC(test_case->config.fixture.size);
-        if (data == NULL) {
-            summary->error = "failed to allocate the data\0";
-            RXP_LOG_ERROR_2("failed to allocate the data"
-                            "(suite: \"%s\", case: \"%s\")\n",
-                            test_case->suite_name,
-                            test_case->name);
-            return RX_ERROR_ALLOCATION;
-        }
-    } else {
-        data = NULL;
-    }
-
-    if (test_case->config.fixture.config.set_up != NULL) {
-        status = test_case->config.fixture.config.set_up(&context, data);
-        if (status != RX_SUCCESS) {
-            summary->error = "failed to set-up the fixture\0";
-            RXP_LOG_ERROR_2("failed to set-up the fixture "
-                            "(suite: \"%s\", case: \"%s\")\n",
-                            test_case->suite_name,
-                            test_case->name);
-            goto data_cleanup;
-        }
-    }
-
-    if (rxp_get_real_time(&time_begin) != RX_SUCCESS) {
-        time_begin = (uint64_t)-1;
-    }
-
-    if (setjmp(context.env) == 0) {
-        test_case->run(&context, data);
-    }
-
-    if (time_begin == (uint64_t)-1
-        || rxp_get_real_time(&time_end) != RX_SUCCESS) {
-        RXP_LOG_ERROR_2("failed to measure the time elapsed "
-                        "(suite: \"%s\", case: \"%s\")\n",
-                        test_case->suite_name,
-                        test_case->name);
-        summary->elapsed = 0;
-    } else {
-        RX_ASSERT(time_end >= time_begin);
-        summary->elapsed = (rx_uint64)(time_end - time_begin);
-    }
-
-    if (test_case->config.fixture.config.tear_down != NULL) {
-        test_case->config.fixture.config.tear_down(&context, data);
-    }
-
-data_cleanup:
-    RX_FREE(data);
-    return status;
+    return rxp_test_case_run(summary, test_case, NULL, NULL, 0);
 }
 
 RXP_MAYBE_UNUSED RXP_STORAGE void
 rx_enumerate_test_cases(rx_size *test_case_count,
                         struct rx_test_case *test_cases)
 {
-    size_t i;
-    const struct rxp_test_case_desc * const *c_it;
-
-    RX_ASSERT(test_case_count != NULL);
-
-#if !RXP_TEST_DISCOVERY
-    RXP_UNUSED(test_cases);
-    RXP_UNUSED(i);
-    RXP_UNUSED(c_it);
-
-    *test_case_count = 0;
-    return;
-#else
-    if (test_cases == NULL) {
-        *test_case_count = 0;
-        for (c_it = RXP_TEST_CASE_SECTION_BEGIN;
-             c_it != RXP_TEST_CASE_SECTION_END;
-             ++c_it) {
-            *test_case_count += (rx_size)(*c_it != NULL);
-        }
-
-        return;
-    }
-
-    i = 0;
-    for (c_it = RXP_TEST_CASE_SECTION_BEGIN;
-         c_it != RXP_TEST_CASE_SECTION_END;
-         ++c_it) {
-        const struct rxp_test_suite_desc * const *s_it;
-        struct rxp_test_case_config_blueprint config_blueprint;
-        struct rx_test_case *test_case;
-
-        if (*c_it == NULL) {
-            continue;
-        }
-
-        /* Find the corresponding test suite description, if any. */
-        for (s_it = RXP_TEST_SUITE_SECTION_BEGIN;
-             s_it != RXP_TEST_SUITE_SECTION_END;
-             ++s_it) {
-            if (*s_it == NULL) {
-                continue;
-            }
-
-            if (strcmp((*s_it)->name, (*c_it)->suite_name) == 0) {
-                break;
-            }
-        }
-
-        memset(&config_blueprint, 0, sizeof config_blueprint);
-
-        if (s_it != RXP_TEST_SUITE_SECTION_END
-            && (*s_it)->config_desc != NULL) {
-            /* Inherit the config from the test suite's description. */
-            (*s_it)->config_desc->update(&config_blueprint);
-        }
-
-        if ((*c_it)->config_desc != NULL) {
-            /* Inherit the config from the test case's description. */
-            (*c_it)->config_desc->update(&config_blueprint);
-        }
-
-        test_case = &test_cases[i];
-
-        test_case->suite_name = (*c_it)->suite_name;
-        test_case->name = (*c_it)->name;
-        test_case->run = (*c_it)->run;
-
-        test_case->config.skip = config_blueprint.skip;
-
-        memset(&test_case->config.fixture, 0, sizeof test_case->config.fixture);
-
-        if (config_blueprint.fixture != NULL) {
-            test_case->config.fixture.size = config_blueprint.fixture->size;
-
-            if (config_blueprint.fixture->update != NULL) {
-                config_blueprint.fixture->update(
-                    &test_case->config.fixture.config);
-            }
-        }
-
-        ++i;
-    }
-
-    RX_ASSERT(i == *test_case_count);
+    enum rx_status status;
 
-    /* Objects that are defined in a custom memory section can only be retrieved
-       in an undefined order, so these need to be manually sorted afterwards
-       in a sensible way. */
-    qsort(test_cases,
-          *test_case_count,
-          sizeof *test_cases,
-          rxp_compare_test_cases);
-#endif
+    /* Enumerating without a filter can't fail. */
+    status = rxp_enumerate_test_cases(test_case_count, test_cases, NULL);
+    RX_ASSERT(status == RX_SUCCESS);
+    RXP_UNUSED(status);
 }
 
 RXP_MAYBE_UNUSED RXP_STORAGE enum rx_status
 rx_run(rx_size test_case_count, const struct rx_test_case *test_cases)
 {
-    if (test_cases != NULL) {
-        return rxp_run_test_cases(test_case_count, test_cases);
-    }
+    enum rx_status status;
+    struct rxp_options options;
 
-    /* If no test cases are explicitly passed, fallback to discovering the
-       ones defined through the automatic registration framework. */
-    return rxp_run_registered_test_cases();
+    rxp_options_parse(&options, 0, NULL);
+    status = rxp_run(test_case_count, test_cases, &options);
+    rxp_options_terminate(&options);
+    return status;
 }
 
 RXP_MAYBE_UNUSED RXP_STORAGE enum rx_status
@@ -3231,10 +11495,19 @@ rx_main(rx_size test_case_count,
         int argc,
         const char * const *argv)
 {
-    RXP_UNUSED(argc);
-    RXP_UNUSED(argv);
+    enum rx_status status;
+    struct rxp_options options;
 
-    return rx_run(test_case_count, test_cases);
+    status = rxp_options_parse(&options, argc, argv);
+    if (status == RX_SUCCESS) {
+        status = options.list_format != RXP_LIST_FORMAT_NONE
+                     ? rxp_list_test_cases(
+                         test_case_count, test_cases, &options)
+                     : rxp_run(test_case_count, test_cases, &options);
+    }
+
+    rxp_options_terminate(&options);
+    return status;
 }
 
 /* Assertion Macro Helpers                                         O-(''Q)
@@ -0,0 +1,118 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+static unsigned long benchmark_iteration_count;
+static unsigned long test_case_iteration_count;
+static unsigned long break_iteration_count;
+
+RX_BENCHMARK(my_test_suite, sum)
+{
+    volatile unsigned long sum;
+
+    sum = 0;
+    RX_BENCH_LOOP
+    {
+        sum += 1;
+        ++benchmark_iteration_count;
+    }
+}
+
+/* Breaking out of the loop ends the benchmark. */
+RX_BENCHMARK(my_test_suite, break_early)
+{
+    RX_BENCH_LOOP
+    {
+        ++break_iteration_count;
+        break;
+    }
+}
+
+/* Outside of a benchmark, the loop runs its body once. */
+RX_TEST_CASE(my_test_suite, loop_once)
+{
+    RX_BENCH_LOOP
+    {
+        ++test_case_iteration_count;
+    }
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"benchmark"};
+    static const char * const argv_2[] = {"benchmark",
+                                          "--benchmark",
+                                          "--benchmark-min-time=1",
+                                          "--benchmark-samples=5"};
+    static const char * const argv_3[]
+        = {"benchmark", "--benchmark-samples=0"};
+    rx_size test_case_count;
+    struct rx_test_case *test_cases;
+    struct rx_summary summary;
+    const struct rx_benchmark_stats *stats;
+
+    /* Benchmarks are skipped by default. */
+    ASSERT(rx_main(0, NULL, 1, argv_1) == RX_SUCCESS);
+    ASSERT(benchmark_iteration_count == 0);
+    ASSERT(test_case_iteration_count == 1);
+
+    ASSERT(rx_main(0, NULL, 4, argv_2) == RX_SUCCESS);
+    ASSERT(benchmark_iteration_count > 5);
+    ASSERT(test_case_iteration_count == 2);
+    ASSERT(break_iteration_count == 1);
+
+    ASSERT(rx_main(0, NULL, 2, argv_3) == RX_ERROR);
+
+    rx_enumerate_test_cases(&test_case_count, NULL);
+    ASSERT(test_case_count == 3);
+
+    test_cases = (struct rx_test_case *)malloc(sizeof *test_cases
+                                               * test_case_count);
+    ASSERT(test_cases != NULL);
+    rx_enumerate_test_cases(&test_case_count, test_cases);
+
+    ASSERT(strcmp(test_cases[0].name, "break_early") == 0);
+    ASSERT(test_cases[0].benchmark);
+    ASSERT(strcmp(test_cases[1].name, "loop_once") == 0);
+    ASSERT(!test_cases[1].benchmark);
+    ASSERT(strcmp(test_cases[2].name, "sum") == 0);
+    ASSERT(test_cases[2].benchmark);
+
+    /* The partial batch is dropped, leaving no sample to report. */
+    ASSERT(rx_summary_initialize(&summary, &test_cases[0]) == RX_SUCCESS);
+    ASSERT(rx_test_case_run(&summary, &test_cases[0]) == RX_SUCCESS);
+    ASSERT(summary.failure_count == 0);
+    ASSERT(summary.benchmark.sample_count == 0);
+    rx_summary_terminate(&summary);
+
+    /* The settings of the last run still apply. */
+    benchmark_iteration_count = 0;
+    ASSERT(rx_summary_initialize(&summary, &test_cases[2]) == RX_SUCCESS);
+    ASSERT(rx_test_case_run(&summary, &test_cases[2]) == RX_SUCCESS);
+    ASSERT(!summary.skipped);
+    ASSERT(summary.failure_count == 0);
+
+    stats = &summary.benchmark;
+    ASSERT(stats->sample_count == 5);
+    ASSERT(stats->iteration_count > 0);
+    ASSERT(benchmark_iteration_count
+           > (unsigned long)(stats->sample_count * stats->iteration_count));
+    ASSERT(stats->min > 0.0);
+    ASSERT(stats->min <= stats->median);
+    ASSERT(stats->median <= stats->p99);
+    ASSERT(stats->min <= stats->mean);
+    ASSERT(stats->mean <= stats->p99);
+    ASSERT(stats->stddev >= 0.0);
+    rx_summary_terminate(&summary);
+
+    free(test_cases);
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+#define CACHE_FILE "cache.txt"
+
+static int run_counts[3];
+static int failing = 1;
+
+RX_TEST_CASE(my_test_suite, my_test_case_1)
+{
+    ++run_counts[0];
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2)
+{
+    ++run_counts[1];
+    RX_INT_CHECK_EQUAL(failing, 0);
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_3, .skip = 1)
+{
+    ++run_counts[2];
+}
+
+static void
+run(int argc, const char * const *argv, int count_1, int count_2)
+{
+    memset(run_counts, 0, sizeof run_counts);
+    ASSERT(rx_main(0, NULL, argc, argv) == RX_SUCCESS);
+    ASSERT(run_counts[0] == count_1);
+    ASSERT(run_counts[1] == count_2);
+    ASSERT(run_counts[2] == 0);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[]
+        = {"cache", "--cache", CACHE_FILE, "--cache-key", "a"};
+    static const char * const argv_2[]
+        = {"cache", "--cache", CACHE_FILE, "--cache-key", "b"};
+    static const char * const argv_3[]
+        = {"cache", "--cache", CACHE_FILE, "--cache-key", "a", "--no-cache"};
+    static const char * const argv_4[] = {"cache", "--cache", CACHE_FILE};
+
+    remove(CACHE_FILE);
+
+    /* Only the test cases that didn't pass yet are run again. */
+    run(5, argv_1, 1, 1);
+    run(5, argv_1, 0, 1);
+
+    failing = 0;
+    run(5, argv_1, 0, 1);
+    run(5, argv_1, 0, 0);
+
+    /* Changing the key invalidates the cache. */
+    run(5, argv_2, 1, 1);
+    run(5, argv_2, 0, 0);
+
+    /* The records for the other key have been replaced. */
+    run(5, argv_1, 1, 1);
+
+    run(6, argv_3, 1, 1);
+
+    ASSERT(rx_main(0, NULL, 3, argv_4) == RX_ERROR);
+
+    ASSERT(remove(CACHE_FILE) == 0);
+
+    return 0;
+}
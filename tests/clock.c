@@ -0,0 +1,60 @@
+#include <stdlib.h>
+#include <time.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+/* Spins for about 10 ms of processor time. */
+RX_TEST_CASE(my_test_suite, spin)
+{
+    clock_t begin;
+
+    begin = clock();
+    while (clock() - begin < CLOCKS_PER_SEC / 100) {
+    }
+}
+
+static void
+check_elapsed(void)
+{
+    rx_size test_case_count;
+    struct rx_test_case test_case;
+    struct rx_summary summary;
+
+    test_case_count = 1;
+    rx_enumerate_test_cases(&test_case_count, &test_case);
+
+    ASSERT(rx_summary_initialize(&summary, &test_case) == RX_SUCCESS);
+    ASSERT(rx_test_case_run(&summary, &test_case) == RX_SUCCESS);
+    ASSERT(summary.elapsed >= 5000000ul);
+    ASSERT(summary.elapsed < 5000000000ul);
+    rx_summary_terminate(&summary);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"clock", "--clock=default"};
+    static const char * const argv_2[] = {"clock", "--clock=monotonic"};
+    static const char * const argv_3[] = {"clock", "--clock=tsc"};
+    static const char * const argv_4[] = {"clock", "--clock=sundial"};
+
+    ASSERT(rx_main(0, NULL, 2, argv_1) == RX_SUCCESS);
+    check_elapsed();
+
+    ASSERT(rx_main(0, NULL, 2, argv_2) == RX_SUCCESS);
+    check_elapsed();
+
+    /* Falls back to the default clock where the counter is unsupported. */
+    ASSERT(rx_main(0, NULL, 2, argv_3) == RX_SUCCESS);
+    check_elapsed();
+
+    ASSERT(rx_main(0, NULL, 2, argv_4) == RX_ERROR);
+
+    return 0;
+}
@@ -68,7 +68,14 @@ static const struct rx_test_case my_test_cases[] = {
         "my_test_suite",
         "my_test_case",
         my_test_suite_my_test_case,
-        {0, {sizeof(struct my_data), {my_set_up, my_tear_down}}},
+        {0,
+         {sizeof(struct my_data), {my_set_up, my_tear_down, 0, 0, 0, 0}},
+         0,
+         0,
+         {0, {NULL, NULL, 0, 0, 0, 0}},
+         NULL},
+        NULL,
+        0,
     },
 };
 
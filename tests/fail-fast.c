@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+#define LAST_RUN_FILE "fail-fast-last-run.txt"
+#define TIMING_FILE "fail-fast-timings.txt"
+
+static int runs[3] = {0, 0, 0};
+
+RX_TEST_CASE(my_test_suite, my_test_case_1)
+{
+    ++runs[0];
+    RX_CHECK(0);
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2)
+{
+    ++runs[1];
+    RX_CHECK(0);
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_3)
+{
+    ++runs[2];
+}
+
+static int
+read_first_line(char *buf, int size, const char *path)
+{
+    FILE *file;
+    char line[256];
+    int count;
+
+    file = fopen(path, "rb");
+    ASSERT(file != NULL);
+
+    count = 0;
+    buf[0] = '\0';
+    if (fgets(buf, size, file) != NULL) {
+        ++count;
+        while (fgets(line, (int)sizeof line, file) != NULL) {
+            ++count;
+        }
+    }
+
+    fclose(file);
+    return count;
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"fail-fast", "--fail-fast"};
+    static const char * const argv_2[] = {"fail-fast", "--max-failures=2"};
+    static const char * const argv_3[] = {"fail-fast", "--max-failures", "3"};
+    static const char * const argv_4[] = {"fail-fast",
+                                          "--fail-fast",
+                                          "--last-run-file=" LAST_RUN_FILE,
+                                          "--timing-file=" TIMING_FILE};
+    char buf[256];
+
+    ASSERT(rx_main(0, NULL, 2, argv_1) == RX_ERROR_CANCELLED);
+    ASSERT(runs[0] == 1 && runs[1] == 0 && runs[2] == 0);
+
+    ASSERT(rx_main(0, NULL, 2, argv_2) == RX_ERROR_CANCELLED);
+    ASSERT(runs[0] == 2 && runs[1] == 1 && runs[2] == 0);
+
+    /* The budget isn't exhausted, all the test cases are run. */
+    ASSERT(rx_main(0, NULL, 3, argv_3) == RX_SUCCESS);
+    ASSERT(runs[0] == 3 && runs[1] == 2 && runs[2] == 1);
+
+    /* The results of the completed test cases are persisted on cancel. */
+    remove(LAST_RUN_FILE);
+    remove(TIMING_FILE);
+    ASSERT(rx_main(0, NULL, 4, argv_4) == RX_ERROR_CANCELLED);
+    ASSERT(runs[0] == 4 && runs[1] == 2 && runs[2] == 1);
+
+    ASSERT(read_first_line(buf, (int)sizeof buf, LAST_RUN_FILE) == 1);
+    ASSERT(strcmp(buf, "my_test_suite\tmy_test_case_1\t1\n") == 0);
+    ASSERT(read_first_line(buf, (int)sizeof buf, TIMING_FILE) == 1);
+    ASSERT(strncmp(buf, "my_test_suite\tmy_test_case_1\t", 29) == 0);
+
+    ASSERT(remove(LAST_RUN_FILE) == 0);
+    ASSERT(remove(TIMING_FILE) == 0);
+
+    return 0;
+}
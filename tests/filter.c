@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+static int runs_1_1 = 0;
+static int runs_1_2 = 0;
+static int runs_2_1 = 0;
+
+RX_TEST_CASE(my_test_suite_1, my_test_case_1)
+{
+    ++runs_1_1;
+}
+
+RX_TEST_CASE(my_test_suite_1, my_test_case_2)
+{
+    ++runs_1_2;
+}
+
+RX_TEST_CASE(my_test_suite_2, my_test_case_1)
+{
+    ++runs_2_1;
+}
+
+static void
+reset(void)
+{
+    runs_1_1 = 0;
+    runs_1_2 = 0;
+    runs_2_1 = 0;
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[]
+        = {"filter", "--filter=my_test_suite_1/*"};
+    static const char * const argv_2[]
+        = {"filter", "--filter", "*/my_test_case_1", "--filter=-*_2/*"};
+    static const char * const argv_3[]
+        = {"filter", "--filter=-my_test_suite_?/my_test_case_2"};
+    static const char * const argv_4[] = {"filter", "--filter=nothing"};
+
+    ASSERT(rx_main(0, NULL, 2, argv_1) == RX_SUCCESS);
+    ASSERT(runs_1_1 == 1 && runs_1_2 == 1 && runs_2_1 == 0);
+
+    reset();
+    ASSERT(rx_main(0, NULL, 4, argv_2) == RX_SUCCESS);
+    ASSERT(runs_1_1 == 1 && runs_1_2 == 0 && runs_2_1 == 0);
+
+    reset();
+    ASSERT(rx_main(0, NULL, 2, argv_3) == RX_SUCCESS);
+    ASSERT(runs_1_1 == 1 && runs_1_2 == 0 && runs_2_1 == 1);
+
+    reset();
+    ASSERT(rx_main(0, NULL, 2, argv_4) == RX_SUCCESS);
+    ASSERT(runs_1_1 == 0 && runs_1_2 == 0 && runs_2_1 == 0);
+
+#if defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 2
+    {
+        static const char * const argv_5[]
+            = {"filter", "--filter-regex=^my_test_suite_[12]/.*_1$"};
+        static const char * const argv_6[]
+            = {"filter", "--filter-regex=("};
+
+        reset();
+        ASSERT(rx_main(0, NULL, 2, argv_5) == RX_SUCCESS);
+        ASSERT(runs_1_1 == 1 && runs_1_2 == 0 && runs_2_1 == 1);
+
+        ASSERT(rx_main(0, NULL, 2, argv_6) == RX_ERROR);
+    }
+#endif
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+struct my_data {
+    int value;
+    char buffer[100];
+};
+
+static int tear_down_count = 0;
+
+RX_SET_UP(my_set_up)
+{
+    struct my_data *data;
+
+    data = (struct my_data *)RX_DATA;
+    data->value = 123;
+    return RX_SUCCESS;
+}
+
+RX_TEAR_DOWN(my_tear_down)
+{
+    struct my_data *data;
+
+    data = (struct my_data *)RX_DATA;
+    ASSERT(data->value == 123);
+    ++tear_down_count;
+}
+
+RX_FIXTURE(my_aligned_fixture,
+           struct my_data,
+           .set_up = my_set_up,
+           .tear_down = my_tear_down,
+           .alignment = 64);
+
+RX_FIXTURE(my_huge_fixture,
+           struct my_data,
+           .set_up = my_set_up,
+           .tear_down = my_tear_down,
+           .huge_pages = 1);
+
+RX_TEST_CASE(my_test_suite, aligned, .fixture = my_aligned_fixture)
+{
+    struct my_data *data;
+
+    data = (struct my_data *)RX_DATA;
+    ASSERT(((size_t)RX_DATA & 63) == 0);
+    ASSERT(data->value == 123);
+    data->buffer[sizeof data->buffer - 1] = 1;
+}
+
+/* Huge pages might not be available, in which case a regular block is used. */
+RX_TEST_CASE(my_test_suite, huge_pages, .fixture = my_huge_fixture)
+{
+    struct my_data *data;
+
+    data = (struct my_data *)RX_DATA;
+    ASSERT(RX_DATA != NULL);
+    ASSERT(data->value == 123);
+    data->buffer[sizeof data->buffer - 1] = 1;
+}
+
+int
+main(int argc, const char **argv)
+{
+    ASSERT(rx_main(0, NULL, argc, argv) == RX_SUCCESS);
+    ASSERT(tear_down_count == 2);
+    return 0;
+}
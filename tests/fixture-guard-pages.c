@@ -0,0 +1,71 @@
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+struct my_data {
+    char buffer[64];
+};
+
+static int runs = 0;
+
+RX_SET_UP(my_set_up)
+{
+    struct my_data *data;
+
+    data = (struct my_data *)RX_DATA;
+    memset(data->buffer, 1, sizeof data->buffer);
+    return RX_SUCCESS;
+}
+
+RX_FIXTURE(my_fixture, struct my_data, .set_up = my_set_up, .guard_pages = 1);
+
+RX_TEST_CASE(my_test_suite, in_bounds, .fixture = my_fixture)
+{
+    struct my_data *data;
+    size_t i;
+
+    data = (struct my_data *)RX_DATA;
+    for (i = 0; i < sizeof data->buffer; ++i) {
+        RX_INT_REQUIRE_EQUAL(data->buffer[i], 1);
+        data->buffer[i] = 2;
+    }
+
+    ++runs;
+}
+
+RX_TEST_CASE(my_test_suite, out_of_bounds, .fixture = my_fixture)
+{
+    volatile char *buffer;
+
+    buffer = ((struct my_data *)RX_DATA)->buffer;
+    RX_INT_REQUIRE_EQUAL(buffer[0], 1);
+    buffer[sizeof(struct my_data)] = 2;
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[]
+        = {"fixture-guard-pages", "--filter=*in_bounds"};
+    static const char * const argv_2[] = {"fixture-guard-pages"};
+    static const char * const argv_3[] = {"fixture-guard-pages", "--isolate"};
+    static const char * const argv_4[]
+        = {"fixture-guard-pages", "--jobs=2"};
+
+    /* Test cases using guard pages are always isolated. */
+    ASSERT(rx_main(0, NULL, 2, argv_1) == RX_SUCCESS);
+    ASSERT(runs == 0);
+
+    /* Overflows fault on the guard page and are reported as crashes. */
+    ASSERT(rx_main(0, NULL, 1, argv_2) == RX_ERROR_ABORTED);
+    ASSERT(rx_main(0, NULL, 2, argv_3) == RX_ERROR_ABORTED);
+    ASSERT(rx_main(0, NULL, 2, argv_4) == RX_ERROR_ABORTED);
+
+    return 0;
+}
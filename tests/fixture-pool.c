@@ -0,0 +1,78 @@
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+struct my_data {
+    int value;
+    char buffer[40];
+};
+
+static const void *previous_data = NULL;
+static int reuse_count = 0;
+static int fill = -1;
+
+RX_SET_UP(my_set_up)
+{
+    struct my_data *data;
+    size_t i;
+
+    data = (struct my_data *)RX_DATA;
+
+    /* Fresh and reused blocks are filled the same way. */
+    if (fill < 0) {
+        fill = (unsigned char)data->buffer[0];
+    }
+
+    for (i = 0; i < sizeof data->buffer; ++i) {
+        ASSERT((unsigned char)data->buffer[i] == fill);
+    }
+
+    /* Reused blocks don't leak the content of the previous test case. */
+    if (RX_DATA == previous_data) {
+        ++reuse_count;
+        ASSERT(data->value != 123);
+    }
+
+    data->value = 123;
+    return RX_SUCCESS;
+}
+
+RX_FIXTURE(my_fixture, struct my_data, .set_up = my_set_up);
+
+RX_TEST_SUITE(my_test_suite, .fixture = my_fixture);
+
+#define DEFINE_TEST_CASE(ID)                                                   \
+    RX_TEST_CASE(my_test_suite, my_test_case_##ID)                             \
+    {                                                                          \
+        struct my_data *data;                                                  \
+                                                                               \
+        data = (struct my_data *)RX_DATA;                                      \
+                                                                               \
+        ASSERT(data->value == 123);                                            \
+        previous_data = RX_DATA;                                               \
+    }
+
+DEFINE_TEST_CASE(0)
+DEFINE_TEST_CASE(1)
+DEFINE_TEST_CASE(2)
+DEFINE_TEST_CASE(3)
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"fixture-pool"};
+    static const char * const argv_2[] = {"fixture-pool", "--threads=2"};
+
+    ASSERT(rx_main(0, NULL, 1, argv_1) == RX_SUCCESS);
+    ASSERT(reuse_count == 3);
+
+    ASSERT(rx_main(0, NULL, 2, argv_2) == RX_SUCCESS);
+
+    return 0;
+}
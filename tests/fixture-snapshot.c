@@ -0,0 +1,98 @@
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+#define TABLE_SIZE 256
+#define ALIGNMENT 256
+
+static int set_up_count = 0;
+static int tear_down_count = 0;
+
+struct my_data {
+    int table[TABLE_SIZE];
+};
+
+RX_SET_UP(my_set_up)
+{
+    struct my_data *data;
+    int i;
+
+    data = (struct my_data *)RX_DATA;
+
+    /* The snapshot honours the memory options of the fixture. */
+    ASSERT(((size_t)data & (ALIGNMENT - 1)) == 0);
+
+    ++set_up_count;
+    for (i = 0; i < TABLE_SIZE; ++i) {
+        data->table[i] = i * i;
+    }
+
+    return RX_SUCCESS;
+}
+
+RX_TEAR_DOWN(my_tear_down)
+{
+    struct my_data *data;
+
+    data = (struct my_data *)RX_DATA;
+
+    ++tear_down_count;
+    ASSERT(data->table[TABLE_SIZE - 1] == (TABLE_SIZE - 1) * (TABLE_SIZE - 1));
+}
+
+RX_FIXTURE(my_fixture,
+           struct my_data,
+           .set_up = my_set_up,
+           .tear_down = my_tear_down,
+           .alignment = ALIGNMENT,
+           .snapshot = 1);
+
+RX_TEST_SUITE(my_test_suite, .fixture = my_fixture);
+
+/* Each test case starts from a pristine copy, whatever the previous did. */
+#define DEFINE_TEST_CASE(ID)                                                   \
+    RX_TEST_CASE(my_test_suite, my_test_case_##ID)                             \
+    {                                                                          \
+        struct my_data *data;                                                  \
+        int i;                                                                 \
+                                                                               \
+        data = (struct my_data *)RX_DATA;                                      \
+                                                                               \
+        ASSERT(set_up_count == 1);                                             \
+        for (i = 0; i < TABLE_SIZE; ++i) {                                     \
+            ASSERT(data->table[i] == i * i);                                   \
+            data->table[i] = -1;                                               \
+        }                                                                      \
+    }
+
+DEFINE_TEST_CASE(0)
+DEFINE_TEST_CASE(1)
+DEFINE_TEST_CASE(2)
+
+static void
+run(int argc, const char * const *argv)
+{
+    set_up_count = 0;
+    tear_down_count = 0;
+    ASSERT(rx_main(0, NULL, argc, argv) == RX_SUCCESS);
+    ASSERT(set_up_count == 1);
+    ASSERT(tear_down_count == 1);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"fixture-snapshot"};
+    static const char * const argv_2[] = {"fixture-snapshot", "--repeat=2"};
+
+    run(1, argv_1);
+    run(2, argv_2);
+
+    return 0;
+}
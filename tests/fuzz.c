@@ -0,0 +1,121 @@
+#define RX_ENABLE_FUZZING
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+#define CORPUS_DIR "fuzz-corpus"
+#define SUITE_DIR CORPUS_DIR "/my_test_suite"
+#define TEST_DIR SUITE_DIR "/parse"
+#define GOOD_FILE TEST_DIR "/good"
+#define BAD_FILE TEST_DIR "/bad"
+
+static int input_count;
+
+/* Fails for any input starting with `bad`. */
+RX_FUZZ_TEST(my_test_suite, parse)
+{
+    ++input_count;
+    RX_UINT_REQUIRE_EQUAL(RX_FUZZ_DATA != NULL, 1);
+    if (RX_FUZZ_SIZE >= 3) {
+        RX_INT_REQUIRE_EQUAL(memcmp(RX_FUZZ_DATA, "bad", 3) != 0, 1);
+    }
+}
+
+struct my_data {
+    int value;
+};
+
+static int fixture_input_count;
+
+RX_SET_UP(my_set_up)
+{
+    ((struct my_data *)RX_DATA)->value = 123;
+    return RX_SUCCESS;
+}
+
+RX_FIXTURE(my_fixture, struct my_data, .set_up = my_set_up);
+
+RX_TEST_SUITE(my_fixture_test_suite, .fixture = my_fixture);
+
+/* Each input is run against a fixture set up for it. */
+RX_FUZZ_TEST(my_fixture_test_suite, parse)
+{
+    ++fixture_input_count;
+    RX_INT_REQUIRE_EQUAL(((struct my_data *)RX_DATA)->value, 123);
+    ((struct my_data *)RX_DATA)->value = 0;
+}
+
+static void
+write_file(const char *path, const char *content)
+{
+    FILE *file;
+
+    file = fopen(path, "wb");
+    ASSERT(file != NULL);
+    ASSERT(fwrite(content, 1, strlen(content), file) == strlen(content));
+    ASSERT(fclose(file) == 0);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"fuzz"};
+    static const char * const argv_2[] = {"fuzz", "--corpus", CORPUS_DIR};
+
+    remove(GOOD_FILE);
+    remove(BAD_FILE);
+    remove(TEST_DIR);
+    remove(SUITE_DIR);
+    remove(CORPUS_DIR);
+
+    /* Without a corpus, only the empty input is replayed. */
+    input_count = 0;
+    ASSERT(rx_main(0, NULL, 1, argv_1) == RX_SUCCESS);
+    ASSERT(input_count == 1);
+
+    /* A missing corpus directory is not an error. */
+    input_count = 0;
+    ASSERT(rx_main(0, NULL, 3, argv_2) == RX_SUCCESS);
+    ASSERT(input_count == 1);
+
+    ASSERT(mkdir(CORPUS_DIR, 0755) == 0);
+    ASSERT(mkdir(SUITE_DIR, 0755) == 0);
+    ASSERT(mkdir(TEST_DIR, 0755) == 0);
+
+    write_file(GOOD_FILE, "good input");
+    input_count = 0;
+    ASSERT(rx_main(0, NULL, 3, argv_2) == RX_SUCCESS);
+    ASSERT(input_count == 2);
+
+    /* Each input is replayed even after another one failed. */
+    write_file(BAD_FILE, "bad input");
+    input_count = 0;
+    ASSERT(rx_main(0, NULL, 3, argv_2) == RX_ERROR_ABORTED);
+    ASSERT(input_count == 3);
+
+    /* The fuzzing entry point runs the inputs through the fuzz tests. */
+    input_count = 0;
+    fixture_input_count = 0;
+    ASSERT(LLVMFuzzerTestOneInput((const uint8_t *)"good", 4) == 0);
+    ASSERT(LLVMFuzzerTestOneInput(NULL, 0) == 0);
+    ASSERT(input_count == 2);
+    ASSERT(fixture_input_count == 2);
+
+    ASSERT(remove(GOOD_FILE) == 0);
+    ASSERT(remove(BAD_FILE) == 0);
+    ASSERT(remove(TEST_DIR) == 0);
+    ASSERT(remove(SUITE_DIR) == 0);
+    ASSERT(remove(CORPUS_DIR) == 0);
+
+    return 0;
+}
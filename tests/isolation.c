@@ -0,0 +1,58 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+static volatile int spin = 1;
+static int runs = 0;
+
+RX_TEST_CASE(my_test_suite, my_test_case_1)
+{
+    RX_INT_REQUIRE_EQUAL(1, 1);
+    abort();
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2, .timeout_ms = 50)
+{
+    while (spin) {
+    }
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_3)
+{
+    ++runs;
+    RX_INT_REQUIRE_EQUAL(runs, 1);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"isolation", "--isolate"};
+    static const char * const argv_2[]
+        = {"isolation", "--isolate", "--threads=2"};
+    static const char * const argv_3[]
+        = {"isolation", "--isolate", "--jobs=2"};
+    static const char * const argv_4[] = {"isolation", "--isolate=2"};
+    static const char * const argv_5[] = {"isolation", "--isolate=3"};
+
+    /* Crashing test cases fail without stopping the run. Worker threads are
+       ignored when isolating the test cases. */
+    ASSERT(rx_main(0, NULL, 2, argv_1) == RX_ERROR_ABORTED);
+    ASSERT(rx_main(0, NULL, 3, argv_2) == RX_ERROR_ABORTED);
+    ASSERT(rx_main(0, NULL, 3, argv_3) == RX_ERROR_ABORTED);
+
+    /* Batches resume after the test case that crashed. */
+    ASSERT(rx_main(0, NULL, 2, argv_4) == RX_ERROR_ABORTED);
+    ASSERT(rx_main(0, NULL, 2, argv_5) == RX_ERROR_ABORTED);
+
+    /* Side effects of the test cases don't leak into the runner. */
+    ASSERT(runs == 0);
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+#define LAST_RUN_FILE "jobs-last-run.txt"
+
+struct marker {
+    int index;
+    pid_t pid;
+};
+
+static int marker_fd = -1;
+
+/* The test cases run in the worker processes, so they report to the runner
+   through a pipe. */
+static void
+mark(int index)
+{
+    struct marker marker;
+
+    marker.index = index;
+    marker.pid = getpid();
+    ASSERT(write(marker_fd, &marker, sizeof marker) == sizeof marker);
+}
+
+static void
+collect(pid_t *pids, int fd)
+{
+    struct marker marker;
+
+    memset(pids, 0, sizeof *pids * 5);
+    while (read(fd, &marker, sizeof marker) == sizeof marker) {
+        ASSERT(marker.index > 0 && marker.index < 5);
+        ASSERT(pids[marker.index] == 0);
+        pids[marker.index] = marker.pid;
+    }
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_1)
+{
+    mark(1);
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2)
+{
+    mark(2);
+    abort();
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_3)
+{
+    struct timespec duration;
+
+    /* Keep the first worker busy while the second one is respawned and
+       picks up the last test case. */
+    duration.tv_sec = 0;
+    duration.tv_nsec = 300000000L;
+    nanosleep(&duration, NULL);
+    mark(3);
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_4)
+{
+    mark(4);
+}
+
+static void
+run(pid_t *pids, int argc, const char * const *argv)
+{
+    int fds[2];
+
+    ASSERT(pipe(fds) == 0);
+    marker_fd = fds[1];
+    ASSERT(rx_main(0, NULL, argc, argv) == RX_ERROR_ABORTED);
+    close(fds[1]);
+    collect(pids, fds[0]);
+    close(fds[0]);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[]
+        = {"jobs", "--jobs", "2", "--last-run-file", LAST_RUN_FILE};
+    static const char * const argv_2[] = {"jobs",
+                                          "--jobs",
+                                          "2",
+                                          "--last-run-file",
+                                          LAST_RUN_FILE,
+                                          "--last-failed"};
+    pid_t pids[5];
+    int i;
+
+    remove(LAST_RUN_FILE);
+
+    /* The crash is reported as a fatal failure without stopping the run. */
+    run(pids, 5, argv_1);
+    for (i = 1; i < 5; ++i) {
+        ASSERT(pids[i] != 0);
+        ASSERT(pids[i] != getpid());
+    }
+
+    /* Each worker runs every other test case, and the one that crashed is
+       replaced by a new worker. */
+    ASSERT(pids[1] == pids[3]);
+    ASSERT(pids[4] != pids[2]);
+    ASSERT(pids[4] != pids[3]);
+
+    /* Only the test case that crashed is recorded as failed. */
+    run(pids, 6, argv_2);
+    ASSERT(pids[1] == 0);
+    ASSERT(pids[2] != 0);
+    ASSERT(pids[3] == 0);
+    ASSERT(pids[4] == 0);
+
+    ASSERT(remove(LAST_RUN_FILE) == 0);
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+#define LAST_RUN_FILE "last-run.txt"
+
+static int order[3];
+static int run_count = 0;
+static int failing = 1;
+
+RX_TEST_CASE(my_test_suite, my_test_case_1)
+{
+    order[run_count++] = 1;
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2)
+{
+    order[run_count++] = 2;
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_3)
+{
+    order[run_count++] = 3;
+    RX_INT_CHECK_EQUAL(failing, 0);
+}
+
+static void
+run(int argc, const char * const *argv, int count, int first)
+{
+    run_count = 0;
+    ASSERT(rx_main(0, NULL, argc, argv) == RX_SUCCESS);
+    ASSERT(run_count == count);
+    ASSERT(order[0] == first);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[]
+        = {"last-run", "--last-run-file", LAST_RUN_FILE};
+    static const char * const argv_2[]
+        = {"last-run", "--last-run-file", LAST_RUN_FILE, "--failed-first"};
+    static const char * const argv_3[]
+        = {"last-run", "--last-run-file", LAST_RUN_FILE, "--last-failed"};
+    static const char * const argv_4[] = {"last-run", "--last-failed"};
+
+    remove(LAST_RUN_FILE);
+
+    /* Without any recorded failure, all the test cases run. */
+    run(4, argv_3, 3, 1);
+
+    run(4, argv_2, 3, 3);
+    ASSERT(order[1] == 1);
+    ASSERT(order[2] == 2);
+
+    run(4, argv_3, 1, 3);
+
+    /* Passing clears the failure. */
+    failing = 0;
+    run(4, argv_3, 1, 3);
+    run(3, argv_1, 3, 1);
+    run(4, argv_2, 3, 1);
+
+    ASSERT(rx_main(0, NULL, 2, argv_4) == RX_ERROR);
+
+    ASSERT(remove(LAST_RUN_FILE) == 0);
+
+    return 0;
+}
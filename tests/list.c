@@ -0,0 +1,40 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+static int runs = 0;
+
+RX_TEST_CASE(my_test_suite, my_test_case_1)
+{
+    ++runs;
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2)
+{
+    ++runs;
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"list", "--list"};
+    static const char * const argv_2[]
+        = {"list", "--list=json", "--filter=*_2"};
+    static const char * const argv_3[] = {"list", "--list=unknown"};
+
+    /* Listing the test cases doesn't run them. */
+    ASSERT(rx_main(0, NULL, 2, argv_1) == RX_SUCCESS);
+    ASSERT(rx_main(0, NULL, 3, argv_2) == RX_SUCCESS);
+    ASSERT(runs == 0);
+
+    ASSERT(rx_main(0, NULL, 2, argv_3) == RX_ERROR);
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+#define ROW_COUNT 12
+
+struct my_row {
+    int a;
+    int b;
+    int sum;
+};
+
+static const struct my_row my_rows[ROW_COUNT] = {
+    {0, 0, 0},
+    {1, 0, 1},
+    {0, 1, 1},
+    {1, 1, 2},
+    {2, 3, 5},
+    {-1, 1, 0},
+    {-2, -3, -5},
+    {10, 20, 30},
+    {100, -100, 0},
+    {7, 8, 15},
+    {1000, 1, 1001},
+    {42, 0, 42},
+};
+
+static int runs[ROW_COUNT];
+
+RX_TEST_CASE_PARAMS(my_test_suite, sum, my_rows, ROW_COUNT)
+{
+    const struct my_row *row;
+
+    row = (const struct my_row *)RX_PARAM;
+    ASSERT(row >= &my_rows[0] && row < &my_rows[ROW_COUNT]);
+
+    RX_INT_REQUIRE_EQUAL(row->a + row->b, row->sum);
+    ++runs[row - my_rows];
+}
+
+RX_TEST_CASE_PARAMS(my_test_suite,
+                    sum_in_threads,
+                    my_rows,
+                    ROW_COUNT,
+                    .parallel_safe = 1)
+{
+    const struct my_row *row;
+
+    row = (const struct my_row *)RX_PARAM;
+    RX_INT_REQUIRE_EQUAL(row->a + row->b, row->sum);
+}
+
+RX_TEST_CASE(my_test_suite, plain)
+{
+    ASSERT(RX_PARAM == NULL);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"params"};
+    static const char * const argv_2[] = {"params", "--filter=*/sum[10]"};
+    static const char * const argv_3[] = {"params", "--threads=4"};
+    rx_size test_case_count;
+    struct rx_test_case *test_cases;
+    size_t i;
+
+    /* Each row is enumerated as a test case of its own, in order. */
+    rx_enumerate_test_cases(&test_case_count, NULL);
+    ASSERT(test_case_count == 1 + 2 * ROW_COUNT);
+
+    test_cases = (struct rx_test_case *)malloc(sizeof *test_cases
+                                               * test_case_count);
+    ASSERT(test_cases != NULL);
+    rx_enumerate_test_cases(&test_case_count, test_cases);
+
+    ASSERT(strcmp(test_cases[0].name, "plain") == 0);
+    ASSERT(strcmp(test_cases[1].name, "sum[0]") == 0);
+    ASSERT(strcmp(test_cases[2].name, "sum[1]") == 0);
+    ASSERT(strcmp(test_cases[11].name, "sum[10]") == 0);
+    ASSERT(test_cases[11].param == &my_rows[10]);
+    free(test_cases);
+
+    ASSERT(rx_main(0, NULL, 1, argv_1) == RX_SUCCESS);
+    for (i = 0; i < ROW_COUNT; ++i) {
+        ASSERT(runs[i] == 1);
+    }
+
+    ASSERT(rx_main(0, NULL, 2, argv_2) == RX_SUCCESS);
+    ASSERT(runs[10] == 2);
+    ASSERT(runs[11] == 1);
+
+    ASSERT(rx_main(0, NULL, 2, argv_3) == RX_SUCCESS);
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+static int
+find_failure(const struct rx_summary *summary, const char *text)
+{
+    size_t i;
+
+    for (i = 0; i < summary->failure_count; ++i) {
+        const struct rx_failure *failure;
+
+        failure = &summary->failures[i];
+        if ((failure->msg != NULL && strstr(failure->msg, text) != NULL)
+            || (failure->diagnostic_msg != NULL
+                && strstr(failure->diagnostic_msg, text) != NULL)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+RX_PROPERTY(addition_commutes)
+{
+    long a;
+    long b;
+
+    a = (long)RX_GEN_INT(-1000000, 1000000);
+    b = (long)RX_GEN_INT(-1000000, 1000000);
+    RX_INT_CHECK_EQUAL(a + b, b + a);
+}
+
+RX_PROPERTY(values_in_range)
+{
+    long i;
+    unsigned long u;
+    long double r;
+    unsigned char bytes[8];
+    char str[9];
+    rx_size size;
+    rx_size length;
+
+    i = (long)RX_GEN_INT(-5, 10);
+    RX_INT_CHECK_GREATER_OR_EQUAL(i, -5);
+    RX_INT_CHECK_LESSER_OR_EQUAL(i, 10);
+
+    u = (unsigned long)RX_GEN_UINT(3, 7);
+    RX_UINT_CHECK_GREATER_OR_EQUAL(u, 3);
+    RX_UINT_CHECK_LESSER_OR_EQUAL(u, 7);
+
+    r = RX_GEN_REAL(-1.5, 2.5);
+    RX_REAL_CHECK_GREATER_OR_EQUAL(r, -1.5);
+    RX_REAL_CHECK_LESSER_OR_EQUAL(r, 2.5);
+
+    size = RX_GEN_BYTES(bytes, 2, sizeof bytes);
+    RX_UINT_CHECK_GREATER_OR_EQUAL(size, 2);
+    RX_UINT_CHECK_LESSER_OR_EQUAL(size, sizeof bytes);
+
+    length = RX_GEN_STR(str, 0, sizeof str - 1);
+    RX_UINT_CHECK_EQUAL(strlen(str), length);
+}
+
+/* Fails for any value of at least 100, which shrinks down to 100. */
+RX_PROPERTY(below_100)
+{
+    long x;
+
+    x = (long)RX_GEN_INT(0, 1000000);
+    RX_INT_CHECK_LESSER(x, 100);
+}
+
+/* Fails for any string containing a `z`, which shrinks down to "z". */
+RX_PROPERTY(no_z)
+{
+    char str[65];
+
+    RX_GEN_STR(str, 0, sizeof str - 1);
+    RX_INT_REQUIRE_EQUAL(strchr(str, 'z') == NULL, 1);
+}
+
+RX_TEST_CASE(my_test_suite, passing)
+{
+    RX_PROPERTY_CHECK(addition_commutes);
+    RX_PROPERTY_CHECK(values_in_range);
+}
+
+RX_TEST_CASE(my_test_suite, failing)
+{
+    RX_PROPERTY_CHECK(below_100);
+    RX_PROPERTY_REQUIRE(no_z);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"property",
+                                          "--filter=*/passing",
+                                          "--property-runs=10000",
+                                          "--property-seed=42"};
+    static const char * const argv_2[] = {"property", "--filter=*/failing"};
+    rx_size test_case_count;
+    struct rx_test_case *test_cases;
+    struct rx_summary summary;
+
+    ASSERT(rx_main(0, NULL, 4, argv_1) == RX_SUCCESS);
+    ASSERT(rx_main(0, NULL, 2, argv_2) == RX_ERROR_ABORTED);
+
+    rx_enumerate_test_cases(&test_case_count, NULL);
+    ASSERT(test_case_count == 2);
+
+    test_cases = (struct rx_test_case *)malloc(sizeof *test_cases
+                                               * test_case_count);
+    ASSERT(test_cases != NULL);
+    rx_enumerate_test_cases(&test_case_count, test_cases);
+
+    ASSERT(strcmp(test_cases[1].name, "passing") == 0);
+    ASSERT(rx_summary_initialize(&summary, &test_cases[1]) == RX_SUCCESS);
+    ASSERT(rx_test_case_run(&summary, &test_cases[1]) == RX_SUCCESS);
+    ASSERT(summary.failure_count == 0);
+    rx_summary_terminate(&summary);
+
+    /* Counterexamples are shrunk to the minimal failing input. */
+    ASSERT(strcmp(test_cases[0].name, "failing") == 0);
+    ASSERT(rx_summary_initialize(&summary, &test_cases[0]) == RX_SUCCESS);
+    ASSERT(rx_test_case_run(&summary, &test_cases[0]) == RX_SUCCESS);
+    ASSERT(find_failure(&summary, "the property `below_100` failed"));
+    ASSERT(find_failure(&summary, "counterexample: 100"));
+    ASSERT(find_failure(&summary, "100 < 100"));
+    ASSERT(find_failure(&summary, "the property `no_z` failed"));
+    ASSERT(find_failure(&summary, "counterexample: \"z\""));
+    ASSERT(summary.failures[summary.failure_count - 1].severity == RX_FATAL);
+    rx_summary_terminate(&summary);
+
+    free(test_cases);
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+static int runs = 0;
+static int flaky_runs = 0;
+
+RX_TEST_CASE(my_test_suite, my_test_case_1)
+{
+    ++runs;
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2)
+{
+    /* Fail on every fifth run only. */
+    ++flaky_runs;
+    RX_INT_CHECK_NOT_EQUAL(flaky_runs % 5, 0);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"repeat", "--repeat=3"};
+    static const char * const argv_2[] = {"repeat", "--until-fail"};
+    static const char * const argv_3[]
+        = {"repeat", "--until-fail", "--repeat=2"};
+    static const char * const argv_4[] = {"repeat", "--repeat=0"};
+
+    ASSERT(rx_main(0, NULL, 2, argv_1) == RX_SUCCESS);
+    ASSERT(runs == 3);
+    ASSERT(flaky_runs == 3);
+
+    /* Stop on the pass where the flaky test case fails. */
+    ASSERT(rx_main(0, NULL, 2, argv_2) == RX_SUCCESS);
+    ASSERT(runs == 5);
+    ASSERT(flaky_runs == 5);
+
+    /* The number of repetitions bounds the search for a failure. */
+    ASSERT(rx_main(0, NULL, 3, argv_3) == RX_SUCCESS);
+    ASSERT(runs == 7);
+
+    ASSERT(rx_main(0, NULL, 2, argv_4) == RX_ERROR);
+
+    return 0;
+}
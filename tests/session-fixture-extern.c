@@ -0,0 +1,28 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+struct my_session_data {
+    int value;
+};
+
+/* Defined in `session-fixture.c`. */
+RX_SESSION_FIXTURE_DECLARE(my_session_fixture);
+
+RX_TEST_CASE(my_test_suite_4,
+             my_test_case,
+             .session_fixture = my_session_fixture)
+{
+    struct my_session_data *data;
+
+    data = (struct my_session_data *)RX_SESSION_DATA;
+
+    ASSERT(data->value == 123);
+}
@@ -0,0 +1,104 @@
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+static int set_up_count = 0;
+static int tear_down_count = 0;
+
+struct my_session_data {
+    int value;
+};
+
+RX_SET_UP(my_set_up)
+{
+    struct my_session_data *data;
+
+    data = (struct my_session_data *)RX_DATA;
+
+    ++set_up_count;
+    data->value = 123;
+    return RX_SUCCESS;
+}
+
+RX_TEAR_DOWN(my_tear_down)
+{
+    struct my_session_data *data;
+
+    data = (struct my_session_data *)RX_DATA;
+
+    ++tear_down_count;
+    ASSERT(data->value == 123);
+}
+
+/* Also used from `session-fixture-extern.c`. */
+RX_SESSION_FIXTURE_DECLARE(my_session_fixture);
+
+RX_SESSION_FIXTURE(my_session_fixture,
+                   struct my_session_data,
+                   .set_up = my_set_up,
+                   .tear_down = my_tear_down);
+
+RX_TEST_SUITE(my_test_suite_1, .session_fixture = my_session_fixture);
+
+RX_TEST_CASE(my_test_suite_1, my_test_case)
+{
+    struct my_session_data *data;
+
+    data = (struct my_session_data *)RX_SESSION_DATA;
+
+    ASSERT(set_up_count == 1);
+    ASSERT(tear_down_count == 0);
+    ASSERT(data->value == 123);
+}
+
+RX_TEST_CASE(my_test_suite_2,
+             my_test_case,
+             .session_fixture = my_session_fixture)
+{
+    struct my_session_data *data;
+
+    data = (struct my_session_data *)RX_SESSION_DATA;
+
+    ASSERT(set_up_count == 1);
+    ASSERT(tear_down_count == 0);
+    ASSERT(data->value == 123);
+}
+
+RX_TEST_CASE(my_test_suite_3, my_test_case)
+{
+    ASSERT(RX_SESSION_DATA == NULL);
+}
+
+static void
+run(int argc, const char * const *argv, int count)
+{
+    set_up_count = 0;
+    tear_down_count = 0;
+    ASSERT(rx_main(0, NULL, argc, argv) == RX_SUCCESS);
+    ASSERT(set_up_count == count);
+    ASSERT(tear_down_count == count);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"session-fixture"};
+    static const char * const argv_2[] = {"session-fixture", "--repeat=3"};
+    static const char * const argv_3[]
+        = {"session-fixture", "--filter", "my_test_suite_3/*"};
+
+    /* Set up once for the whole run, even across passes. */
+    run(1, argv_1, 1);
+    run(2, argv_2, 1);
+
+    /* Not set up at all when no selected test case depends on it. */
+    run(3, argv_3, 0);
+
+    return 0;
+}
@@ -0,0 +1,32 @@
+#include <rexo.h>
+
+/* Test cases defined in another translation unit than the runner's. */
+
+int property_run_count = 0;
+int fuzz_input_count = 0;
+
+RX_PROPERTY(count_runs)
+{
+    ++property_run_count;
+}
+
+RX_TEST_CASE(my_test_suite, property)
+{
+    RX_PROPERTY_CHECK(count_runs);
+}
+
+RX_FUZZ_TEST(my_test_suite, fuzz)
+{
+    ++fuzz_input_count;
+}
+
+RX_BENCHMARK(my_test_suite, benchmark)
+{
+    volatile int value;
+
+    value = 0;
+    RX_BENCH_LOOP
+    {
+        ++value;
+    }
+}
@@ -0,0 +1,92 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+#define CORPUS_DIR "settings-corpus"
+#define SUITE_DIR CORPUS_DIR "/my_test_suite"
+#define TEST_DIR SUITE_DIR "/fuzz"
+#define INPUT_FILE TEST_DIR "/input"
+
+/* Defined in `settings-extern.c`. */
+extern int property_run_count;
+extern int fuzz_input_count;
+
+int
+main(void)
+{
+    static const char * const argv_1[]
+        = {"settings", "--filter=*/property", "--property-runs=7"};
+    static const char * const argv_2[]
+        = {"settings", "--filter=*/fuzz", "--corpus", CORPUS_DIR};
+    static const char * const argv_3[] = {"settings",
+                                          "--filter=*/benchmark",
+                                          "--benchmark",
+                                          "--benchmark-min-time=1",
+                                          "--benchmark-samples=3",
+                                          "--clock=tsc"};
+    FILE *file;
+    rx_size test_case_count;
+    struct rx_test_case *test_cases;
+    struct rx_summary summary;
+    rx_size i;
+
+    /* The options reach the test cases of the other translation units. */
+    ASSERT(rx_main(0, NULL, 3, argv_1) == RX_SUCCESS);
+    ASSERT(property_run_count == 7);
+
+    remove(INPUT_FILE);
+    remove(TEST_DIR);
+    remove(SUITE_DIR);
+    remove(CORPUS_DIR);
+
+    ASSERT(mkdir(CORPUS_DIR, 0755) == 0);
+    ASSERT(mkdir(SUITE_DIR, 0755) == 0);
+    ASSERT(mkdir(TEST_DIR, 0755) == 0);
+
+    file = fopen(INPUT_FILE, "wb");
+    ASSERT(file != NULL);
+    ASSERT(fclose(file) == 0);
+
+    /* The empty input is replayed, followed by the corpus. */
+    ASSERT(rx_main(0, NULL, 4, argv_2) == RX_SUCCESS);
+    ASSERT(fuzz_input_count == 2);
+
+    ASSERT(remove(INPUT_FILE) == 0);
+    ASSERT(remove(TEST_DIR) == 0);
+    ASSERT(remove(SUITE_DIR) == 0);
+    ASSERT(remove(CORPUS_DIR) == 0);
+
+    ASSERT(rx_main(0, NULL, 6, argv_3) == RX_SUCCESS);
+
+    rx_enumerate_test_cases(&test_case_count, NULL);
+    test_cases = (struct rx_test_case *)malloc(sizeof *test_cases
+                                               * test_case_count);
+    ASSERT(test_cases != NULL);
+    rx_enumerate_test_cases(&test_case_count, test_cases);
+
+    for (i = 0; i < test_case_count; ++i) {
+        if (strcmp(test_cases[i].name, "benchmark") == 0) {
+            break;
+        }
+    }
+
+    ASSERT(i < test_case_count);
+    ASSERT(rx_summary_initialize(&summary, &test_cases[i]) == RX_SUCCESS);
+    ASSERT(rx_test_case_run(&summary, &test_cases[i]) == RX_SUCCESS);
+    ASSERT(summary.failure_count == 0);
+    ASSERT(summary.benchmark.sample_count == 3);
+    rx_summary_terminate(&summary);
+
+    free(test_cases);
+
+    return 0;
+}
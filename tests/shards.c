@@ -0,0 +1,103 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+#define TIMING_FILE "shards.txt"
+#define OUTPUT_FILE "shards-output.txt"
+
+static int runs[4] = {0, 0, 0, 0};
+
+RX_TEST_CASE(my_test_suite, my_test_case_1)
+{
+    ++runs[0];
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2)
+{
+    ++runs[1];
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_3)
+{
+    ++runs[2];
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_4)
+{
+    ++runs[3];
+}
+
+static void
+write_timing_file(void)
+{
+    FILE *file;
+
+    file = fopen(TIMING_FILE, "wb");
+    ASSERT(file != NULL);
+    fputs("my_test_suite\tmy_test_case_1\t100\n"
+          "my_test_suite\tmy_test_case_2\t1\n"
+          "my_test_suite\tmy_test_case_3\t1\n"
+          "my_test_suite\tmy_test_case_4\t1\n",
+          file);
+    ASSERT(fclose(file) == 0);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[]
+        = {"shards", "--shard-count", "2", "--shard-index", "0"};
+    static const char * const argv_2[]
+        = {"shards", "--shard-count", "2", "--shard-index", "1"};
+    static const char * const argv_3[] = {"shards",
+                                          "--shard-count=2",
+                                          "--shard-index=0",
+                                          "--shard-timing-file=" TIMING_FILE,
+                                          "--timing-file=" OUTPUT_FILE};
+    static const char * const argv_4[] = {"shards",
+                                          "--shard-count=2",
+                                          "--shard-index=1",
+                                          "--shard-timing-file=" TIMING_FILE,
+                                          "--timing-file=" OUTPUT_FILE};
+    static const char * const argv_5[]
+        = {"shards", "--shard-count", "2", "--shard-index", "2"};
+    static const char * const argv_6[] = {"shards",
+                                          "--shard-count=2",
+                                          "--shard-index=0",
+                                          "--shard-timing-file=" TIMING_FILE,
+                                          "--timing-file=" TIMING_FILE};
+    int shard_size;
+
+    /* Every test case runs in exactly one shard. */
+    ASSERT(rx_main(0, NULL, 5, argv_1) == RX_SUCCESS);
+    shard_size = runs[0] + runs[1] + runs[2] + runs[3];
+    ASSERT(rx_main(0, NULL, 5, argv_2) == RX_SUCCESS);
+    ASSERT(runs[0] == 1 && runs[1] == 1 && runs[2] == 1 && runs[3] == 1);
+
+    /* The shards are balanced by duration when timings are available. */
+    write_timing_file();
+    ASSERT(rx_main(0, NULL, 5, argv_3) == RX_SUCCESS);
+    ASSERT(runs[0] == 2 && runs[1] == 1 && runs[2] == 1 && runs[3] == 1);
+
+    /* The shard timing file is left untouched by the runs. */
+    ASSERT(rx_main(0, NULL, 5, argv_4) == RX_SUCCESS);
+    ASSERT(runs[0] == 2 && runs[1] == 2 && runs[2] == 2 && runs[3] == 2);
+
+    /* A shard timing file that is also written falls back to the hashes. */
+    ASSERT(rx_main(0, NULL, 5, argv_6) == RX_SUCCESS);
+    ASSERT(runs[0] + runs[1] + runs[2] + runs[3] == 8 + shard_size);
+
+    ASSERT(remove(TIMING_FILE) == 0);
+    ASSERT(remove(OUTPUT_FILE) == 0);
+
+    ASSERT(rx_main(0, NULL, 5, argv_5) == RX_ERROR);
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+static int set_up_count = 0;
+static int tear_down_count = 0;
+static int run_count = 0;
+
+struct my_shared_data {
+    int value;
+};
+
+struct my_data {
+    int value;
+};
+
+RX_SET_UP(my_shared_set_up)
+{
+    struct my_shared_data *data;
+
+    data = (struct my_shared_data *)RX_DATA;
+
+    ++set_up_count;
+    data->value = 123;
+    return RX_SUCCESS;
+}
+
+RX_TEAR_DOWN(my_shared_tear_down)
+{
+    struct my_shared_data *data;
+
+    data = (struct my_shared_data *)RX_DATA;
+
+    ++tear_down_count;
+    ASSERT(data->value == 123);
+}
+
+RX_FIXTURE(my_shared_fixture,
+           struct my_shared_data,
+           .set_up = my_shared_set_up,
+           .tear_down = my_shared_tear_down);
+
+RX_SET_UP(my_set_up)
+{
+    struct my_data *data;
+    struct my_shared_data *shared_data;
+
+    data = (struct my_data *)RX_DATA;
+    shared_data = (struct my_shared_data *)RX_SHARED_DATA;
+
+    /* The shared data is already available to the per-case fixtures. */
+    data->value = shared_data->value + 1;
+    return RX_SUCCESS;
+}
+
+RX_FIXTURE(my_fixture, struct my_data, .set_up = my_set_up);
+
+RX_TEST_SUITE(my_test_suite, .shared_fixture = my_shared_fixture);
+
+RX_TEST_CASE(my_test_suite, my_test_case_1)
+{
+    struct my_shared_data *shared_data;
+
+    shared_data = (struct my_shared_data *)RX_SHARED_DATA;
+
+    ++run_count;
+    ASSERT(set_up_count == tear_down_count + 1);
+    ASSERT(shared_data->value == 123);
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2, .fixture = my_fixture)
+{
+    struct my_data *data;
+
+    data = (struct my_data *)RX_DATA;
+
+    ++run_count;
+    ASSERT(set_up_count == tear_down_count + 1);
+    ASSERT(data->value == 124);
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_3, .parallel_safe = 1)
+{
+    ++run_count;
+    ASSERT(set_up_count == tear_down_count + 1);
+    ASSERT(RX_SHARED_DATA != NULL);
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_4, .skip = 1)
+{
+    ASSERT(0);
+}
+
+RX_TEST_CASE(my_test_suite_2, my_test_case)
+{
+    ++run_count;
+    ASSERT(RX_SHARED_DATA == NULL);
+}
+
+static void
+run(int argc, const char * const *argv, int pass_count)
+{
+    set_up_count = 0;
+    tear_down_count = 0;
+    run_count = 0;
+    ASSERT(rx_main(0, NULL, argc, argv) == RX_SUCCESS);
+    ASSERT(run_count == 4 * pass_count);
+    ASSERT(set_up_count == pass_count);
+    ASSERT(tear_down_count == pass_count);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"shared-fixture"};
+    static const char * const argv_2[] = {"shared-fixture", "--threads=2"};
+    static const char * const argv_3[] = {"shared-fixture", "--repeat=2"};
+    static const char * const argv_4[]
+        = {"shared-fixture", "--filter", "my_test_suite/my_test_case_1"};
+
+    run(1, argv_1, 1);
+    run(2, argv_2, 1);
+
+    /* Each pass sets up its own instance. */
+    run(2, argv_3, 2);
+
+    set_up_count = 0;
+    tear_down_count = 0;
+    ASSERT(rx_main(0, NULL, 3, argv_4) == RX_SUCCESS);
+    ASSERT(set_up_count == 1);
+    ASSERT(tear_down_count == 1);
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+#define TEST_CASE_COUNT 8
+
+static int order[TEST_CASE_COUNT];
+static int run_count = 0;
+
+#define DEFINE_TEST_CASE(ID)                                                   \
+    RX_TEST_CASE(my_test_suite, my_test_case_##ID)                             \
+    {                                                                          \
+        order[run_count++] = ID;                                               \
+    }
+
+DEFINE_TEST_CASE(0)
+DEFINE_TEST_CASE(1)
+DEFINE_TEST_CASE(2)
+DEFINE_TEST_CASE(3)
+DEFINE_TEST_CASE(4)
+DEFINE_TEST_CASE(5)
+DEFINE_TEST_CASE(6)
+DEFINE_TEST_CASE(7)
+
+static void
+run(int *result, int argc, const char * const *argv)
+{
+    int seen[TEST_CASE_COUNT];
+    int i;
+
+    run_count = 0;
+    ASSERT(rx_main(0, NULL, argc, argv) == RX_SUCCESS);
+    ASSERT(run_count == TEST_CASE_COUNT);
+
+    /* Each test case runs exactly once. */
+    memset(seen, 0, sizeof seen);
+    for (i = 0; i < TEST_CASE_COUNT; ++i) {
+        ASSERT(order[i] >= 0 && order[i] < TEST_CASE_COUNT);
+        ASSERT(!seen[order[i]]);
+        seen[order[i]] = 1;
+    }
+
+    memcpy(result, order, sizeof order);
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"shuffle", "--seed=42"};
+    static const char * const argv_2[] = {"shuffle", "--seed=43"};
+    static const char * const argv_3[] = {"shuffle", "--shuffle"};
+    static const char * const argv_4[] = {"shuffle", "--seed=4294967296"};
+    int order_1[TEST_CASE_COUNT];
+    int order_2[TEST_CASE_COUNT];
+    int order_3[TEST_CASE_COUNT];
+
+    /* The same seed replays the same order. */
+    run(order_1, 2, argv_1);
+    run(order_2, 2, argv_1);
+    ASSERT(memcmp(order_1, order_2, sizeof order_1) == 0);
+
+    run(order_2, 2, argv_2);
+    ASSERT(memcmp(order_1, order_2, sizeof order_1) != 0);
+
+    run(order_3, 2, argv_3);
+
+    ASSERT(rx_main(0, NULL, 2, argv_4) == RX_ERROR);
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+static pthread_t main_thread;
+
+RX_TEST_SUITE(my_test_suite, .parallel_safe = 1);
+
+RX_TEST_CASE(my_test_suite, my_test_case_1)
+{
+    RX_REQUIRE(!pthread_equal(pthread_self(), main_thread));
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2, .parallel_safe = 0)
+{
+    RX_REQUIRE(pthread_equal(pthread_self(), main_thread));
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_3)
+{
+    RX_REQUIRE(!pthread_equal(pthread_self(), main_thread));
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_4)
+{
+    RX_REQUIRE(!pthread_equal(pthread_self(), main_thread));
+}
+
+int
+main(void)
+{
+    static const char * const argv[] = {"threads", "--threads", "2"};
+
+    main_thread = pthread_self();
+
+    ASSERT(rx_main(0, NULL, 3, argv) == RX_SUCCESS);
+
+    return 0;
+}
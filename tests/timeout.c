@@ -0,0 +1,55 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+static volatile int spin = 1;
+static int run_count;
+
+RX_TEST_CASE(my_test_suite, my_test_case_1, .timeout_ms = 50)
+{
+    while (spin) {
+    }
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2)
+{
+    ++run_count;
+    RX_REQUIRE(1);
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_3, .timeout_ms = 50)
+{
+    while (spin) {
+    }
+}
+
+int
+main(void)
+{
+    static const char * const argv_1[] = {"timeout"};
+    static const char * const argv_2[] = {"timeout", "--threads=2"};
+    static const char * const argv_3[]
+        = {"timeout", "--timeout=50", "--jobs=2"};
+    static const char * const argv_4[]
+        = {"timeout", "--timeout=50", "--isolate"};
+
+    /* Test cases with a timeout are run in a child process that is killed
+       on expiry, and the run carries on with the next test case. */
+    ASSERT(rx_main(0, NULL, 1, argv_1) == RX_ERROR_ABORTED);
+    ASSERT(run_count == 1);
+    ASSERT(rx_main(0, NULL, 2, argv_2) == RX_ERROR_ABORTED);
+    ASSERT(run_count == 2);
+
+    /* Same for test cases running in worker or isolated processes. */
+    ASSERT(rx_main(0, NULL, 3, argv_3) == RX_ERROR_ABORTED);
+    ASSERT(rx_main(0, NULL, 3, argv_4) == RX_ERROR_ABORTED);
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rexo.h>
+
+#define ASSERT(x)                                                              \
+    (void)(                                                                    \
+        (x)                                                                    \
+        || (printf(__FILE__ ":%d: assertion `" #x "` failed\n", __LINE__), 0)  \
+        || (abort(), 0))
+
+#define TIMING_FILE "timing-file.txt"
+
+RX_TEST_CASE(my_test_suite, my_test_case_1)
+{
+    RX_INT_REQUIRE_EQUAL(42, 42);
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_2, .skip = 1)
+{
+    RX_INT_REQUIRE_EQUAL(42, 42);
+}
+
+RX_TEST_CASE(my_test_suite, my_test_case_3)
+{
+    RX_INT_REQUIRE_EQUAL(42, 42);
+}
+
+int
+main(void)
+{
+    static const char * const argv[]
+        = {"timing-file", "--timing-file", TIMING_FILE, "--threads", "2"};
+    char content[256];
+    size_t size;
+    FILE *file;
+
+    file = fopen(TIMING_FILE, "wb");
+    ASSERT(file != NULL);
+    /* The last record isn't terminated by a new line. */
+    fputs("my_test_suite\tmy_test_case_2\t123\n"
+          "my_test_suite\tmy_test_case_3\t999999999\n"
+          "malformed\n"
+          "other_test_suite\tother_test_case\t42",
+          file);
+    ASSERT(fclose(file) == 0);
+
+    ASSERT(rx_main(0, NULL, 5, argv) == RX_SUCCESS);
+
+    file = fopen(TIMING_FILE, "rb");
+    ASSERT(file != NULL);
+    size = fread(content, 1, sizeof content - 1, file);
+    content[size] = '\0';
+    ASSERT(fclose(file) == 0);
+    ASSERT(remove(TIMING_FILE) == 0);
+
+    /* Timings are updated, except for the test cases that didn't run. */
+    ASSERT(strstr(content, "my_test_suite\tmy_test_case_1\t") != NULL);
+    ASSERT(strstr(content, "my_test_suite\tmy_test_case_2\t123\n") != NULL);
+    ASSERT(strstr(content, "my_test_suite\tmy_test_case_3\t") != NULL);
+    ASSERT(strstr(content, "\t999999999\n") == NULL);
+    ASSERT(strstr(content, "other_test_suite\tother_test_case\t42\n") != NULL);
+    ASSERT(strstr(content, "malformed") == NULL);
+
+    return 0;
+}